@@ -5,6 +5,8 @@
 #include "Core/Actor/AccelByteWarsMissile.h"
 
 #include "AccelByteWars/Core/Player/AccelByteWarsPlayerPawn.h"
+#include "AccelByteWars/Core/System/AccelByteWarsActorPoolSubsystem.h"
+#include "AccelByteWars/Core/System/AccelByteWarsMissileSubsystem.h"
 
 // Sets default values
 AAccelByteWarsMissile::AAccelByteWarsMissile()
@@ -32,9 +34,11 @@ AAccelByteWarsMissile::AAccelByteWarsMissile()
 	// Setup Gameplay Object Component
 	AccelByteWarsGameplayObjectComponent = CreateDefaultSubobject<UAccelByteWarsGameplayObjectComponent>(TEXT("AccelByteWarsGameplayObjectComponent"));
 
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// Missiles are stepped in batch by UAccelByteWarsMissileSubsystem
+	PrimaryActorTick.bCanEverTick = false;
 
+	// Clients simulate missiles too, the server's location keeps them from drifting
+	SetReplicateMovement(true);
 }
 
 // Called when the game starts or when spawned
@@ -42,8 +46,52 @@ void AAccelByteWarsMissile::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Ensure near hit ship list is empty on start
-	NearHitShips.Empty();
+	// Pre-warmed instances stay idle until they are acquired
+	UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+	if (ActorPool != nullptr && ActorPool->IsActorInPool(this))
+		Activation.bActive = false;
+
+	if (ActorPool != nullptr && HasAuthority() == false)
+		ActorPool->OnReplicatedInstanceSpawned();
+
+	if (Activation.bActive == false)
+		return;
+
+	ActivateMissile();
+}
+
+void AAccelByteWarsMissile::ActivateMissile()
+{
+	ActivationTime = GetWorld()->GetTimeSeconds();
+
+	// Reset the state left by a previous use of this instance
+	HitObject = nullptr;
+	KillActorThisFrame = false;
+	Expiring = false;
+	TimeAlive = 0.0f;
+	TimeSkimmingPlanet = 0.0f;
+	TimeSkimmingPlanetReward = 0.0f;
+	GravityForce = FVector::ZeroVector;
+	NetLocationError = FVector::ZeroVector;
+
+	// Reused instances bring their FX and sound back to the spawn state
+	if (Activation.Count > 0)
+	{
+		UActorComponent* const ReusedComponents[] = { ThrustSparks, ExpiringSparks, MissileAudioComponent };
+		for (UActorComponent* Component : ReusedComponents)
+		{
+			if (Component == nullptr)
+				continue;
+
+			if (Component->bAutoActivate)
+				Component->Activate(true);
+			else
+				Component->Deactivate();
+		}
+	}
+
+	// Ensure near hit ship list is empty on start, keeping the memory of a previous use
+	NearHitShips.Reset();
 
 	// Get Game State
 	AAccelByteWarsInGameGameState* ABGameState = Cast<AAccelByteWarsInGameGameState>(UGameplayStatics::GetGameState(GetWorld()));
@@ -55,16 +103,191 @@ void AAccelByteWarsMissile::BeginPlay()
 	ScoreIncrement = ABGameState->GameSetup.SkimInitialScore;
 	
 	// Setup event for OnOwnerDestroyed (in blueprint)
-	DestroyActorOnOwnerDestroyed();
+	if (GetOwner() != nullptr)
+		DestroyActorOnOwnerDestroyed();
+
+	// Power ups look up missiles by the owner's team
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	const AAccelByteWarsPlayerState* OwnerPlayerState = OwnerPawn != nullptr ? OwnerPawn->GetPlayerState<AAccelByteWarsPlayerState>() : nullptr;
+	ABGameState->RegisterLiveMissile(this, OwnerPlayerState != nullptr ? OwnerPlayerState->TeamId : INDEX_NONE);
+
+	// Start flying
+	if (UAccelByteWarsMissileSubsystem* MissileSubsystem = GetWorld()->GetSubsystem<UAccelByteWarsMissileSubsystem>())
+	{
+		MissileSubsystem->RegisterMissile(this);
+	}
+}
+
+void AAccelByteWarsMissile::DeactivateMissile()
+{
+	if (UAccelByteWarsMissileSubsystem* MissileSubsystem = GetWorld()->GetSubsystem<UAccelByteWarsMissileSubsystem>())
+	{
+		MissileSubsystem->UnregisterMissile(this);
+	}
+
+	if (AAccelByteWarsInGameGameState* ABGameState = GetWorld()->GetGameState<AAccelByteWarsInGameGameState>())
+	{
+		ABGameState->UnregisterLiveMissile(this);
+	}
+
+	KillActorThisFrame = false;
+
+	if (ThrustSparks != nullptr)
+		ThrustSparks->DeactivateImmediate();
+
+	if (ExpiringSparks != nullptr)
+		ExpiringSparks->DeactivateImmediate();
+
+	if (MissileAudioComponent != nullptr)
+		MissileAudioComponent->Stop();
+
+	if (HasAuthority())
+	{
+		TArray<AActor*> AttachedActors;
+		GetAttachedActors(AttachedActors);
+		for (AActor* AttachedActor : AttachedActors)
+		{
+			AttachedActor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		}
+	}
+
+	// The missile is not destroyed, OnDestroyed stays for the real destruction.
+	// Trails bind to it in blueprint to fade out, they are told about the release instead and the next use of the missile
+	// starts without them. Other listeners are on UAccelByteWarsActorPoolSubsystem::OnActorReleased.
+	for (UObject* Listener : OnDestroyed.GetAllObjects())
+	{
+		if (IAccelByteWarsPoolableActorInterface* PoolableListener = Cast<IAccelByteWarsPoolableActorInterface>(Listener))
+		{
+			OnDestroyed.RemoveAll(Listener);
+			PoolableListener->OnOwnerReleasedToPool(this);
+		}
+	}
+}
+
+float AAccelByteWarsMissile::GetTimeSinceActivation() const
+{
+	return GetWorld()->GetTimeSeconds() - ActivationTime;
+}
+
+void AAccelByteWarsMissile::K2_DestroyActor()
+{
+	// Blueprint destroy paths recycle the missile too
+	ReleaseOrDestroy();
+}
+
+void AAccelByteWarsMissile::ReleaseOrDestroy()
+{
+	if (HasAuthority())
+	{
+		UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+		if (ActorPool != nullptr && ActorPool->ReleaseActor(this))
+			return;
+	}
+
+	Destroy();
+}
+
+void AAccelByteWarsMissile::OnAcquiredFromPool()
+{
+	Activation.Count++;
+	Activation.bActive = true;
+	Activation.Location = GetActorLocation();
+	Activation.Rotation = GetActorRotation();
+	AppliedActivationCount = Activation.Count;
+
+	ActivateMissile();
 }
 
-// Called every frame
-void AAccelByteWarsMissile::Tick(float DeltaTime)
+void AAccelByteWarsMissile::OnReleasedToPool()
 {
-	Super::Tick(DeltaTime);
+	Activation.bActive = false;
 
-	ApplyGravityToThisGameObjects();
-	ApplyOverallGravityForceToChangeTheVelocity(DeltaTime);
+	DeactivateMissile();
+}
+
+void AAccelByteWarsMissile::OnRepNotify_Activation()
+{
+	// A newly replicated instance starts from its replicated location in BeginPlay
+	if (HasActorBegunPlay() == false)
+	{
+		AppliedActivationCount = Activation.Count;
+		return;
+	}
+
+	if (Activation.bActive == false)
+	{
+		DeactivateMissile();
+		return;
+	}
+
+	if (Activation.Count == AppliedActivationCount)
+		return;
+
+	AppliedActivationCount = Activation.Count;
+	SetActorLocationAndRotation(Activation.Location, Activation.Rotation);
+	ActivateMissile();
+
+	if (UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>())
+		ActorPool->OnReplicatedInstanceReused();
+}
+
+void AAccelByteWarsMissile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAccelByteWarsMissileSubsystem* MissileSubsystem = GetWorld()->GetSubsystem<UAccelByteWarsMissileSubsystem>())
+	{
+		MissileSubsystem->UnregisterMissile(this);
+	}
+
+	if (AAccelByteWarsInGameGameState* ABGameState = GetWorld()->GetGameState<AAccelByteWarsInGameGameState>())
+	{
+		ABGameState->UnregisterLiveMissile(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAccelByteWarsMissile::ApplySimulationResult(const FVector& NewLocation, const FVector& NewVelocity, const FVector& NewGravityForce)
+{
+	GravityForce = NewGravityForce;
+	Velocity = NewVelocity;
+	AlignWithVelocityDirection(NewVelocity);
+
+	// The server's simulation is the reference and replicates from here
+	if (HasAuthority())
+	{
+		SetActorLocation(NewLocation);
+		return;
+	}
+
+	// Clients only move by what they simulated this frame, the subsystem already added part of NetLocationError to it
+	AddActorWorldOffset(NewLocation - GetActorLocation());
+}
+
+FVector AAccelByteWarsMissile::ConsumeNetLocationError(const float DeltaTime)
+{
+	// Exponential approach, the same share of the error is left after the same time at any frame rate
+	const float Alpha = NetCorrectionSeconds > 0.0f ? 1.0f - FMath::Exp(-DeltaTime / NetCorrectionSeconds) : 1.0f;
+	const FVector Correction = NetLocationError * Alpha;
+	NetLocationError -= Correction;
+	return Correction;
+}
+
+void AAccelByteWarsMissile::PostNetReceiveLocationAndRotation()
+{
+	// Not simulated (e.g. idle in the pool), take the replicated location as is
+	if (SimulationIndex == INDEX_NONE)
+	{
+		Super::PostNetReceiveLocationAndRotation();
+		return;
+	}
+
+	// Simulated, correct toward the replicated location over the next frames instead of snapping to it
+	const FVector ReplicatedLocation = FRepMovement::RebaseOntoLocalOrigin(GetReplicatedMovement().Location, this);
+	NetLocationError = ReplicatedLocation - GetActorLocation();
+}
+
+void AAccelByteWarsMissile::TickLifetime(float DeltaTime)
+{
 	ExpiryWindowBeforeTimeoutDestruction();
 	DestroyOnTimeout();
 	DestroyOnOutOfBounds();
@@ -72,6 +295,23 @@ void AAccelByteWarsMissile::Tick(float DeltaTime)
 	OnDestroyObject();
 }
 
+void AAccelByteWarsMissile::ApplyVelocity(const FVector& NewVelocity)
+{
+	Velocity = NewVelocity;
+	SyncToMissileSubsystem();
+}
+
+void AAccelByteWarsMissile::SyncToMissileSubsystem() const
+{
+	if (SimulationIndex == INDEX_NONE)
+		return;
+
+	if (UAccelByteWarsMissileSubsystem* MissileSubsystem = GetWorld()->GetSubsystem<UAccelByteWarsMissileSubsystem>())
+	{
+		MissileSubsystem->SyncMissileState(this);
+	}
+}
+
 void AAccelByteWarsMissile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -79,9 +319,15 @@ void AAccelByteWarsMissile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 	DOREPLIFETIME(AAccelByteWarsMissile, Color);
 	DOREPLIFETIME(AAccelByteWarsMissile, Velocity);
 	DOREPLIFETIME(AAccelByteWarsMissile, GravityForce);
+	DOREPLIFETIME(AAccelByteWarsMissile, Activation);
 }
 
 bool AAccelByteWarsMissile::IsNearHitShip(UAccelByteWarsGameplayObjectComponent* ABObjectComponent)
+{
+	return IsNearHitShip(ABObjectComponent, GetActorLocation());
+}
+
+bool AAccelByteWarsMissile::IsNearHitShip(const UAccelByteWarsGameplayObjectComponent* ABObjectComponent, const FVector& Location) const
 {
 	if (ABObjectComponent == nullptr)
 		return false;
@@ -89,8 +335,7 @@ bool AAccelByteWarsMissile::IsNearHitShip(UAccelByteWarsGameplayObjectComponent*
 	if (ABObjectComponent->GetOwner() == nullptr)
 		return false;
 
-	float NearHitDistance = 200.0f;
-	double distance = FVector::Distance(ABObjectComponent->GetOwner()->GetActorLocation(), GetActorLocation());
+	double distance = FVector::Distance(ABObjectComponent->GetOwner()->GetActorLocation(), Location);
 
 	if (ABObjectComponent->ObjectType == EGameplayObjectType::SHIP &&
 		ABObjectComponent->GetOwner() != GetInstigator() &&
@@ -116,7 +361,7 @@ bool AAccelByteWarsMissile::IsSkimmingPlanet(TArray<UAccelByteWarsGameplayObject
 			continue;
 
 		float distance = GetSurfanceDistanceBetweenObjects(ABObjectComponent[i], ABGameplayObject);
-		if (distance < 100.0f)
+		if (distance < SkimmingDistance)
 		{
 			return true;
 		}
@@ -140,27 +385,134 @@ float AAccelByteWarsMissile::GetSurfanceDistanceBetweenObjects(UAccelByteWarsGam
 
 void AAccelByteWarsMissile::GetGravityForceToObject(UAccelByteWarsGameplayObjectComponent* OtherObject, UAccelByteWarsGameplayObjectComponent* ThisObject, float& RetValue1, FVector& RetValue2)
 {
-	if (OtherObject == nullptr)
+	if (ThisObject == nullptr)
 		return;
 
+	CalculateGravityForceToObject(GetActorLocation(), ThisObject->Mass, GravitationalConstant, OtherObject, RetValue1, RetValue2);
+}
+
+bool AAccelByteWarsMissile::CalculateGravityForceToObject(const FVector& Location, const float Mass, const float InGravitationalConstant, const UAccelByteWarsGameplayObjectComponent* OtherObject, float& OutDistance, FVector& OutForce)
+{
+	if (OtherObject == nullptr)
+		return false;
+
 	if (OtherObject->GetOwner() == nullptr)
-		return;
+		return false;
 
-	if (ThisObject == nullptr)
-		return;
+	const FVector OtherLocation = OtherObject->GetOwner()->GetActorLocation();
 
 	float a = OtherObject->Mass * 50.0f;
-	float b = GravitationalConstant * a * ThisObject->Mass;
-	float c = FVector::Distance(OtherObject->GetOwner()->GetActorLocation(), GetActorLocation());
+	float b = InGravitationalConstant * a * Mass;
+	float c = FVector::Distance(OtherLocation, Location);
 	float d = FMath::Pow(c, 1.5f);
 	float e = b / d;
 
-	FVector f = UKismetMathLibrary::GetDirectionUnitVector(GetActorLocation(), OtherObject->GetOwner()->GetActorLocation());
+	FVector f = UKismetMathLibrary::GetDirectionUnitVector(Location, OtherLocation);
 
-	FVector g = f * e;
+	OutDistance = c;
+	OutForce = f * e;
+
+	return true;
+}
+
+FVector AAccelByteWarsMissile::CalculateGravityForce(AAccelByteWarsInGameGameState* ABGameState, const FVector& Location, const float Mass, const float InGravitationalConstant)
+{
+	if (ABGameState == nullptr)
+		return FVector::ZeroVector;
+
+	FVector Force = FVector::ZeroVector;
+
+	// Gravity has no range limit, every object contributes
+	FVector StaticField = FVector::ZeroVector;
+	const bool bHasStaticField = ABGameState->SampleStaticGravityField(Location, StaticField);
+	if (bHasStaticField)
+	{
+		Force = StaticField * (InGravitationalConstant * Mass);
+	}
+
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& GameObjects = bHasStaticField ? ABGameState->GetDynamicGravityBodies() : ABGameState->ActiveGameObjects;
+	for (const UAccelByteWarsGameplayObjectComponent* GameObject : GameObjects)
+	{
+		float Distance = 0.0f;
+		FVector ObjectForce = FVector::ZeroVector;
+		if (CalculateGravityForceToObject(Location, Mass, InGravitationalConstant, GameObject, Distance, ObjectForce))
+		{
+			Force = ObjectForce + Force;
+		}
+	}
 
-	RetValue1 = c;
-	RetValue2 = g;
+	return Force;
+}
+
+bool AAccelByteWarsMissile::PredictTrajectory(AAccelByteWarsInGameGameState* ABGameState, const AAccelByteWarsMissile* MissileTemplate, const FVector& StartLocation, const FVector& StartVelocity, const int32 NumSteps, FAccelByteWarsMissileTrajectory& OutTrajectory)
+{
+	OutTrajectory.Locations.Reset();
+	OutTrajectory.HitObject = nullptr;
+	OutTrajectory.bOutOfBounds = false;
+	OutTrajectory.bTimedOut = false;
+	OutTrajectory.FlightTime = 0.0f;
+
+	if (ABGameState == nullptr || MissileTemplate == nullptr)
+		return false;
+
+	const UAccelByteWarsGameplayObjectComponent* ThisObject = MissileTemplate->AccelByteWarsGameplayObjectComponent;
+	if (ThisObject == nullptr || ThisObject->Mass <= 0.0f)
+		return false;
+
+	const float StepSeconds = FMath::Max(GetDefault<UAccelByteWarsMissileSubsystem>()->FixedStepSeconds, KINDA_SMALL_NUMBER);
+	const float Mass = ThisObject->Mass;
+
+	FVector Location = StartLocation;
+	FVector CurrentVelocity = StartVelocity;
+	TArray<UAccelByteWarsGameplayObjectComponent*> HitCandidates;
+
+	OutTrajectory.Locations.Reserve(NumSteps + 1);
+	OutTrajectory.Locations.Add(Location);
+
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		// Same order as UAccelByteWarsMissileSubsystem::StepMissiles: forces and hits at the pre-step location, then integrate
+		const FVector Force = CalculateGravityForce(ABGameState, Location, Mass, MissileTemplate->GravitationalConstant);
+
+		HitCandidates.Reset();
+		ABGameState->GetGameObjectsNearLocation(Location, ThisObject->Radius * 100.0f, HitCandidates);
+		for (UAccelByteWarsGameplayObjectComponent* GameObject : HitCandidates)
+		{
+			if (GameObject == nullptr || GameObject->GetOwner() == nullptr)
+				continue;
+
+			float a = FVector::Distance(GameObject->GetOwner()->GetActorLocation(), Location) / 100.0f;
+			float b = ThisObject->Radius + GameObject->Radius;
+			if (a < b)
+			{
+				OutTrajectory.HitObject = GameObject;
+			}
+		}
+
+		if (OutTrajectory.HitObject != nullptr)
+			return true;
+
+		CurrentVelocity = CurrentVelocity + ((Force / Mass) * StepSeconds);
+		Location = Location + (StepSeconds * CurrentVelocity);
+		OutTrajectory.FlightTime += StepSeconds;
+		OutTrajectory.Locations.Add(Location);
+
+		// Same rules as DestroyOnOutOfBounds and DestroyOnTimeout
+		if (Location.X <= ABGameState->MinGameBoundExtend.X || Location.X >= ABGameState->MaxGameBoundExtend.X ||
+			Location.Y <= ABGameState->MinGameBoundExtend.Y || Location.Y >= ABGameState->MaxGameBoundExtend.Y)
+		{
+			OutTrajectory.bOutOfBounds = true;
+			return true;
+		}
+
+		if (OutTrajectory.FlightTime > MissileTemplate->MaxTimeAlive)
+		{
+			OutTrajectory.bTimedOut = true;
+			return true;
+		}
+	}
+
+	return true;
 }
 
 void AAccelByteWarsMissile::AlignWithVelocityDirection(FVector InVector)
@@ -191,12 +543,12 @@ void AAccelByteWarsMissile::OnRepNotify_Color()
 
 void AAccelByteWarsMissile::OnRepNotify_Velocity()
 {
-
+	SyncToMissileSubsystem();
 }
 
 void AAccelByteWarsMissile::SetVelocity()
 {
-	Velocity = InitialSpeed * GetActorTransform().GetRotation().GetRightVector();
+	ApplyVelocity(InitialSpeed * GetActorTransform().GetRotation().GetRightVector());
 }
 
 void AAccelByteWarsMissile::ApplyGravityToThisGameObjects()
@@ -208,24 +560,48 @@ void AAccelByteWarsMissile::ApplyGravityToThisGameObjects()
 	if (AccelByteWarsGameplayObjectComponent == nullptr)
 		return;
 
-	GravityForce = FVector::ZeroVector;
+	GravityForce = CalculateGravityForce(ABGameState, GetActorLocation(), AccelByteWarsGameplayObjectComponent->Mass, GravitationalConstant);
+
+	DetectHitObjects();
+}
+
+void AAccelByteWarsMissile::DetectHitObjects()
+{
+	DetectHitObjectsAt(GetActorLocation());
+}
+
+void AAccelByteWarsMissile::DetectHitObjectsAt(const FVector& Location)
+{
+	AAccelByteWarsInGameGameState* ABGameState = Cast<AAccelByteWarsInGameGameState>(UGameplayStatics::GetGameState(GetWorld()));
+	if (ABGameState == nullptr)
+		return;
+
+	if (AccelByteWarsGameplayObjectComponent == nullptr)
+		return;
 
-	for (int i = 0; i < ABGameState->ActiveGameObjects.Num(); i++)
+	// Near hit and hit are short ranged, only visit the objects around the missile
+	NearbyGameObjects.Reset();
+	ABGameState->GetGameObjectsNearLocation(Location, GetNearbyQueryRadius(), NearbyGameObjects);
+
+	for (UAccelByteWarsGameplayObjectComponent* GameObject : NearbyGameObjects)
 	{
-		if (ABGameState->ActiveGameObjects[i] == nullptr)
+		if (GameObject == nullptr || GameObject->GetOwner() == nullptr)
 			continue;
 
-		UAccelByteWarsGameplayObjectComponent* GameObject = ABGameState->ActiveGameObjects[i];
-		if (GameObject == nullptr)
-			continue;
+		float a = FVector::Distance(GameObject->GetOwner()->GetActorLocation(), Location) / 100.0f;
+		float b = AccelByteWarsGameplayObjectComponent->Radius + GameObject->Radius;
 
-		if (IsNearHitShip(GameObject))
+		if (a < b)
 		{
-			if (NearHitShips.Contains(Cast<AActor>(GameObject)) == false)
-			{
-				if (GameObject->GetOwner() == nullptr)
-					continue;
+			HitObject = GameObject;
+			KillActorThisFrame = true;
+		}
 
+		if (IsNearHitShip(GameObject, Location))
+		{
+			// Counted once per ship, hit detection runs several times per frame
+			if (NearHitShips.Contains(GameObject->GetOwner()) == false)
+			{
 				NearHitShips.Add(GameObject->GetOwner());
 
 				APawn* Pawn = Cast<APawn>(GameObject->GetOwner());
@@ -234,33 +610,25 @@ void AAccelByteWarsMissile::ApplyGravityToThisGameObjects()
 
 				APlayerController* PlayerController = Cast<APlayerController>(Pawn->GetController());
 				if (PlayerController == nullptr)
-					return;
+					continue;
 
 				AAccelByteWarsInGameGameMode* ABInGameMode = Cast<AAccelByteWarsInGameGameMode>(UGameplayStatics::GetGameMode(GetWorld()));
 				if (ABInGameMode == nullptr)
-					return;
+					continue;
 
 				ABInGameMode->IncreasePlayerKilledAttempt(PlayerController);
 			}
 		}
-
-		float ret_1 = 0.0f;
-		FVector ret_2 = FVector::ZeroVector;
-		GetGravityForceToObject(GameObject, AccelByteWarsGameplayObjectComponent, ret_1, ret_2);
-
-		GravityForce = ret_2 + GravityForce;
-
-		float a = ret_1 / 100.0f;
-		float b = AccelByteWarsGameplayObjectComponent->Radius + GameObject->Radius;
-
-		if (a < b)
-		{
-			HitObject = GameObject;
-			KillActorThisFrame = true;
-		}
 	}
 }
 
+float AAccelByteWarsMissile::GetNearbyQueryRadius() const
+{
+	// Covers hit (surface distance < own radius), skimming (< own radius + SkimmingDistance) and near hit (center distance <= NearHitDistance)
+	const float OwnRadius = AccelByteWarsGameplayObjectComponent != nullptr ? AccelByteWarsGameplayObjectComponent->Radius * 100.0f : 0.0f;
+	return FMath::Max(NearHitDistance, OwnRadius + SkimmingDistance);
+}
+
 void AAccelByteWarsMissile::ApplyOverallGravityForceToChangeTheVelocity(float DeltaTime)
 {
 	if (AccelByteWarsGameplayObjectComponent == nullptr)
@@ -286,7 +654,7 @@ void AAccelByteWarsMissile::Server_SetMissileForwardVector_Implementation(FVecto
 
 void AAccelByteWarsMissile::ExpiryWindowBeforeTimeoutDestruction()
 {
-	float a = GetGameTimeSinceCreation();
+	float a = GetTimeSinceActivation();
 	float b = MaxTimeAlive - ExpiryTime;
 
 	if (a > b && Expiring == false)
@@ -306,7 +674,7 @@ void AAccelByteWarsMissile::DestroyOnTimeout()
 	if (HasAuthority() == false)
 		return;
 
-	if (GetGameTimeSinceCreation() > MaxTimeAlive)
+	if (GetTimeSinceActivation() > MaxTimeAlive)
 	{
 		KillActorThisFrame = true;
 	}
@@ -344,7 +712,7 @@ void AAccelByteWarsMissile::DestroyByPowerUp()
 
 void AAccelByteWarsMissile::SkimmingAndScoreUpdate(float DeltaTime)
 {
-	if (GetGameTimeSinceCreation() <= 1.0f)
+	if (GetTimeSinceActivation() <= 1.0f)
 		return;
 
 	if (AccelByteWarsGameplayObjectComponent == nullptr)
@@ -354,8 +722,11 @@ void AAccelByteWarsMissile::SkimmingAndScoreUpdate(float DeltaTime)
 	if (ABGameState == nullptr)
 		return;
 
-	// Skimming Planet detection
-	if (IsSkimmingPlanet(ABGameState->ActiveGameObjects, AccelByteWarsGameplayObjectComponent))
+	// Skimming Planet detection, the missile has moved since the hit query
+	NearbyGameObjects.Reset();
+	ABGameState->GetGameObjectsNearLocation(GetActorLocation(), GetNearbyQueryRadius(), NearbyGameObjects);
+
+	if (IsSkimmingPlanet(NearbyGameObjects, AccelByteWarsGameplayObjectComponent))
 	{
 		TimeSkimmingPlanet += DeltaTime;
 		TimeSkimmingPlanetReward += DeltaTime;
@@ -407,35 +778,41 @@ void AAccelByteWarsMissile::OnDestroyObject()
 	if (KillActorThisFrame == false)
 		return;
 
-	if (GetOwner() == nullptr)
-		return;
-
-	if (GetOwner()->GetInstigatorController() == nullptr)
-		return;
-
-	AAccelByteWarsPlayerController* ABPlayerController = Cast<AAccelByteWarsPlayerController>(GetOwner()->GetInstigatorController());
+	// Nobody to credit (e.g. the owner left the match) or no match to report to, the missile just goes away.
+	// Returning with the missile alive would leave it frozen at the impact point in the missile subsystem.
+	AAccelByteWarsPlayerController* ABPlayerController = GetOwner() != nullptr ? Cast<AAccelByteWarsPlayerController>(GetOwner()->GetInstigatorController()) : nullptr;
 	if (ABPlayerController == nullptr)
+	{
+		ReleaseOrDestroy();
 		return;
+	}
 
 	DecrementPlayerMissileCount();
 
 	AAccelByteWarsInGameGameMode* ABInGameMode = Cast<AAccelByteWarsInGameGameMode>(UGameplayStatics::GetGameMode(GetWorld()));
 	if (ABInGameMode == nullptr)
+	{
+		ReleaseOrDestroy();
 		return;
+	}
 
 	if (HitObject != nullptr)
 	{
 		ABInGameMode->OnMissileDestroyed(GetActorLocation(), HitObject, Color, GetOwner());
 
+		// Releasing to the pool resets the missile, keep what the ship destruction needs
+		UAccelByteWarsGameplayObjectComponent* DestroyedObject = HitObject;
+		const float HitScore = Score;
+
 		NearHitShips.Empty();
-		Destroy();
+		ReleaseOrDestroy();
 
-		if (HitObject->ObjectType == EGameplayObjectType::SHIP)
+		if (DestroyedObject->ObjectType == EGameplayObjectType::SHIP)
 		{
-			float a = UKismetMathLibrary::FTrunc(Score);
+			float a = UKismetMathLibrary::FTrunc(HitScore);
 			SpawnScorePopupHud(a);
 
-			ABInGameMode->OnShipDestroyed(HitObject, Score, ABPlayerController);
+			ABInGameMode->OnShipDestroyed(DestroyedObject, HitScore, ABPlayerController);
 
 			HitObject = nullptr;
 		}
@@ -11,6 +11,7 @@
 #include "AccelByteWars/Core/Player/AccelByteWarsPlayerState.h"
 #include "AccelByteWars/Core/Player/AccelByteWarsPlayerController.h"
 #include "AccelByteWars/Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Core/System/AccelByteWarsPoolableActorInterface.h"
 #include "Core/Utilities/AccelByteWarsUtilityLog.h"
 #include "Net/UnrealNetwork.h"
 #include "NiagaraComponent.h"
@@ -23,8 +24,65 @@
 #include "GameFramework/Actor.h"
 #include "AccelByteWarsMissile.generated.h"
 
+/**
+ * @brief Result of a missile trajectory prediction, see AAccelByteWarsMissile::PredictTrajectory
+ */
+USTRUCT(BlueprintType)
+struct FAccelByteWarsMissileTrajectory
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief Simulated locations, one per step, starting with the start location
+	 */
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FVector> Locations;
+
+	/**
+	 * @brief The object the missile would hit, nullptr if none
+	 */
+	UPROPERTY(BlueprintReadOnly)
+	UAccelByteWarsGameplayObjectComponent* HitObject = nullptr;
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bOutOfBounds = false;
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bTimedOut = false;
+
+	/**
+	 * @brief Simulated flight time in seconds until the missile would be destroyed or the step limit is reached
+	 */
+	UPROPERTY(BlueprintReadOnly)
+	float FlightTime = 0.0f;
+};
+
+/**
+ * @brief Replicated use of a pooled missile instance, see UAccelByteWarsActorPoolSubsystem
+ */
+USTRUCT()
+struct FAccelByteWarsMissileActivation
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief Incremented every time the instance is taken from the pool
+	 */
+	UPROPERTY()
+	int32 Count = 0;
+
+	UPROPERTY()
+	bool bActive = true;
+
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+};
+
 UCLASS()
-class ACCELBYTEWARS_API AAccelByteWarsMissile : public AActor
+class ACCELBYTEWARS_API AAccelByteWarsMissile : public AActor, public IAccelByteWarsPoolableActorInterface
 {
 	GENERATED_BODY()
 	
@@ -35,12 +93,92 @@ public:
 protected:
 	//~UObject overridden functions
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~End of UObject overridden functions
 
+	friend class UAccelByteWarsMissileSubsystem;
+
 public:	
-	//~UObject overridden functions
-	virtual void Tick(float DeltaTime) override;
-	//~End of UObject overridden functions
+	//~AActor overridden functions
+	virtual void K2_DestroyActor() override;
+	virtual void PostNetReceiveLocationAndRotation() override;
+	//~End of AActor overridden functions
+
+	//~IAccelByteWarsPoolableActorInterface overridden functions
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	//~End of IAccelByteWarsPoolableActorInterface overridden functions
+
+	/**
+	 * @brief Returns true if the missile is idle in the actor pool and should be ignored
+	 */
+	bool IsInPool() const { return !Activation.bActive; }
+
+	/**
+	 * @brief Gives the missile back to the actor pool, or destroys it if it can't be pooled
+	 */
+	void ReleaseOrDestroy();
+
+	/**
+	 * @brief Mirrors the state computed by UAccelByteWarsMissileSubsystem onto this actor
+	 */
+	void ApplySimulationResult(const FVector& NewLocation, const FVector& NewVelocity, const FVector& NewGravityForce);
+
+	/**
+	 * @brief Client only: part of the distance to the last replicated location to move this frame, taken off the remaining distance
+	 */
+	FVector ConsumeNetLocationError(const float DeltaTime);
+
+	/**
+	 * @brief Expiry, out of bounds, skimming and destroy rules, run after the missile has moved
+	 */
+	void TickLifetime(float DeltaTime);
+
+	/**
+	 * @brief Sets the velocity and hands it to the missile subsystem
+	 */
+	void ApplyVelocity(const FVector& NewVelocity);
+
+	/**
+	 * @brief Gravity pull of one object on a body at Location. Same rules for live and hypothetical missiles.
+	 * @return false if the object is not valid, outputs are untouched
+	 */
+	static bool CalculateGravityForceToObject(
+		const FVector& Location,
+		const float Mass,
+		const float InGravitationalConstant,
+		const UAccelByteWarsGameplayObjectComponent* OtherObject,
+		float& OutDistance,
+		FVector& OutForce);
+
+	/**
+	 * @brief Total gravity pull on a body at Location. Planets and stars are sampled from the game state's static
+	 * gravity field, ships are calculated exactly.
+	 */
+	static FVector CalculateGravityForce(
+		AAccelByteWarsInGameGameState* ABGameState,
+		const FVector& Location,
+		const float Mass,
+		const float InGravitationalConstant);
+
+	/**
+	 * @brief Simulate a hypothetical missile without spawning it. Uses the step size, gravity, hit, bounds and
+	 * timeout rules of live missiles.
+	 * @param ABGameState Game state holding the gameplay objects and the bound
+	 * @param MissileTemplate Missile providing mass, radius, gravitational constant and lifetime, usually a class default object
+	 * @param StartLocation Missile spawn location
+	 * @param StartVelocity Missile initial velocity
+	 * @param NumSteps Max number of fixed steps to simulate
+	 * @param OutTrajectory Output: the simulated flight. Locations keeps its allocation between calls.
+	 * @return false if the inputs are not valid
+	 */
+	static bool PredictTrajectory(
+		AAccelByteWarsInGameGameState* ABGameState,
+		const AAccelByteWarsMissile* MissileTemplate,
+		const FVector& StartLocation,
+		const FVector& StartVelocity,
+		const int32 NumSteps,
+		FAccelByteWarsMissileTrajectory& OutTrajectory);
 
 	/**
 	 * @brief Collision values for missile
@@ -174,6 +312,24 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AccelByteWars)
 		float TickDeltaSeconds = 0.0f;
 
+	/**
+	 * @brief Time for a client to close most of the distance between its simulated location and a replicated location (63%, exponential)
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AccelByteWars)
+		float NetCorrectionSeconds = 0.1f;
+
+	/**
+	 * @brief Distance from the ship's center for the missile to count as a near hit
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AccelByteWars)
+		float NearHitDistance = 200.0f;
+
+	/**
+	 * @brief Distance from an object's surface for the missile to count as skimming it
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AccelByteWars)
+		float SkimmingDistance = 100.0f;
+
 	/**
 	 * @brief Current ships that the missile is zooming past (for skimming)
 	 */
@@ -222,6 +378,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category = AccelByteWars)
 		bool IsNearHitShip(UAccelByteWarsGameplayObjectComponent* ABObjectComponent);
 
+	bool IsNearHitShip(const UAccelByteWarsGameplayObjectComponent* ABObjectComponent, const FVector& Location) const;
+
 	/**
 	 * @brief Calculates the current gravity force to any given planet
 	 */
@@ -246,6 +404,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = AccelByteWars)
 		void ApplyGravityToThisGameObjects();
 
+	/**
+	 * @brief Looks for hit and near hit objects around the missile
+	 */
+	UFUNCTION(BlueprintCallable, Category = AccelByteWars)
+		void DetectHitObjects();
+
+	/**
+	 * @brief Looks for hit and near hit objects around a simulated location of this missile
+	 */
+	void DetectHitObjectsAt(const FVector& Location);
+
+	/**
+	 * @brief Radius for the game state's broadphase query that covers hit, near hit and skimming checks
+	 */
+	float GetNearbyQueryRadius() const;
+
 	/**
 	 * @brief Applies gravity forces to velocity
 	 */
@@ -315,9 +489,61 @@ protected:
 	UFUNCTION()
 		void OnRepNotify_Velocity();
 
+	/**
+	 * @brief Generic on rep notify for the pooled missile being reused or released
+	 */
+	UFUNCTION()
+		void OnRepNotify_Activation();
+
 	/**
 	 * @brief Calculates the distance between objects in 2D space
 	 */
 	UFUNCTION()
 		float GetSurfanceDistanceBetweenObjects(UAccelByteWarsGameplayObjectComponent* OtherObject, UAccelByteWarsGameplayObjectComponent* ThisObject);
+
+	/**
+	 * @brief Pushes the actor's location and velocity to the missile subsystem
+	 */
+	void SyncToMissileSubsystem() const;
+
+	/**
+	 * @brief Per use initialization, from BeginPlay or when reused from the pool
+	 */
+	void ActivateMissile();
+
+	/**
+	 * @brief Stops simulation and FX when the missile goes back to the pool
+	 */
+	void DeactivateMissile();
+
+	/**
+	 * @brief Time since the current use of this instance started, replaces GetGameTimeSinceCreation for pooled missiles
+	 */
+	float GetTimeSinceActivation() const;
+
+	UPROPERTY(ReplicatedUsing = OnRepNotify_Activation)
+		FAccelByteWarsMissileActivation Activation;
+
+	/**
+	 * @brief Activation.Count this instance has applied locally
+	 */
+	int32 AppliedActivationCount = 0;
+
+	float ActivationTime = 0.0f;
+
+	/**
+	 * @brief Slot in UAccelByteWarsMissileSubsystem, INDEX_NONE if not simulated
+	 */
+	int32 SimulationIndex = INDEX_NONE;
+
+	/**
+	 * @brief Client only: distance from the simulated location to the last replicated location not corrected yet
+	 */
+	FVector NetLocationError = FVector::ZeroVector;
+
+	/**
+	 * @brief Scratch list of objects close to the missile, reused every frame
+	 */
+	UPROPERTY(Transient)
+		TArray<UAccelByteWarsGameplayObjectComponent*> NearbyGameObjects;
 };
@@ -5,6 +5,10 @@
 
 #include "Core/Actor/AccelByteWarsMissileTrail.h"
 
+#include "Core/System/AccelByteWarsActorPoolSubsystem.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
 // Sets default values
 AAccelByteWarsMissileTrail::AAccelByteWarsMissileTrail()
 {
@@ -20,6 +24,20 @@ AAccelByteWarsMissileTrail::AAccelByteWarsMissileTrail()
 void AAccelByteWarsMissileTrail::BeginPlay()
 {
 	Super::BeginPlay();
+
+	UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+	if (ActorPool == nullptr)
+		return;
+
+	if (HasAuthority() == false)
+		ActorPool->OnReplicatedInstanceSpawned();
+
+	// Pre-warmed instances stay idle until they are acquired
+	if (ActorPool->IsActorInPool(this))
+	{
+		Activation.bActive = false;
+		MissileTrail->DeactivateImmediate();
+	}
 }
 
 // Called every frame
@@ -33,6 +51,7 @@ void AAccelByteWarsMissileTrail::GetLifetimeReplicatedProps(TArray<FLifetimeProp
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(AAccelByteWarsMissileTrail, TrailColor);
+	DOREPLIFETIME(AAccelByteWarsMissileTrail, Activation);
 }
 
 bool AAccelByteWarsMissileTrail::IsFadeOut()
@@ -59,3 +78,96 @@ void AAccelByteWarsMissileTrail::OnRepNotify_Color()
 	MissileTrail->SetNiagaraVariableLinearColor("RibbonColour", TrailColor);
 }
 
+void AAccelByteWarsMissileTrail::K2_DestroyActor()
+{
+	// Blueprint destroy paths recycle the trail too
+	ReleaseOrDestroy();
+}
+
+void AAccelByteWarsMissileTrail::ReleaseOrDestroy()
+{
+	if (HasAuthority())
+	{
+		UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+		if (ActorPool != nullptr && ActorPool->ReleaseActor(this))
+			return;
+	}
+
+	Destroy();
+}
+
+void AAccelByteWarsMissileTrail::OnAcquiredFromPool()
+{
+	Activation.Count++;
+	Activation.bActive = true;
+	AppliedActivationCount = Activation.Count;
+
+	ResetTrail();
+}
+
+void AAccelByteWarsMissileTrail::OnReleasedToPool()
+{
+	Activation.bActive = false;
+
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	MissileTrail->DeactivateImmediate();
+}
+
+void AAccelByteWarsMissileTrail::OnOwnerReleasedToPool(AActor* InOwner)
+{
+	// Fades out as when the missile is destroyed, the blueprint releases the trail once it is faded
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	TriggerFadeOut();
+}
+
+void AAccelByteWarsMissileTrail::OnRepNotify_Activation()
+{
+	// A newly replicated instance is already fresh
+	if (HasActorBegunPlay() == false)
+	{
+		AppliedActivationCount = Activation.Count;
+		return;
+	}
+
+	if (Activation.bActive == false)
+	{
+		MissileTrail->DeactivateImmediate();
+		return;
+	}
+
+	if (Activation.Count == AppliedActivationCount)
+		return;
+
+	AppliedActivationCount = Activation.Count;
+	ResetTrail();
+
+	if (UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>())
+		ActorPool->OnReplicatedInstanceReused();
+}
+
+void AAccelByteWarsMissileTrail::ResetTrail()
+{
+	const AAccelByteWarsMissileTrail* TrailDefault = GetClass()->GetDefaultObject<AAccelByteWarsMissileTrail>();
+	CurrentAlpha = TrailDefault->CurrentAlpha;
+	WantedAlpha = TrailDefault->WantedAlpha;
+
+	// Drops the ribbon particles of the previous flight
+	MissileTrail->ResetSystem();
+
+	// Delays started by the blueprint BeginPlay of a prewarmed instance would fade this use out early
+	GetWorld()->GetLatentActionManager().RemoveActionsForObject(this);
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+
+	if (GetOwner() != nullptr)
+		GetOwner()->OnDestroyed.AddUniqueDynamic(this, &ThisClass::OnOwnerDestroyed);
+
+	FTimerHandle FadeOutTimerHandle;
+	GetWorldTimerManager().SetTimer(FadeOutTimerHandle, this, &ThisClass::TriggerFadeOut, MaximumLifetime);
+
+	OnTrailReset();
+}
+
+void AAccelByteWarsMissileTrail::OnOwnerDestroyed(AActor* DestroyedActor)
+{
+	TriggerFadeOut();
+}
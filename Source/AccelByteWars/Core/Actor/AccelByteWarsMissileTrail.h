@@ -6,14 +6,33 @@
 
 #include "NiagaraComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Core/System/AccelByteWarsPoolableActorInterface.h"
 
 #include "Net/UnrealNetwork.h"
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "AccelByteWarsMissileTrail.generated.h"
 
+/**
+ * @brief Replicated use of a pooled trail instance, see UAccelByteWarsActorPoolSubsystem
+ */
+USTRUCT()
+struct FAccelByteWarsMissileTrailActivation
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief Incremented every time the instance is taken from the pool
+	 */
+	UPROPERTY()
+	int32 Count = 0;
+
+	UPROPERTY()
+	bool bActive = true;
+};
+
 UCLASS()
-class ACCELBYTEWARS_API AAccelByteWarsMissileTrail : public AActor
+class ACCELBYTEWARS_API AAccelByteWarsMissileTrail : public AActor, public IAccelByteWarsPoolableActorInterface
 {
 	GENERATED_BODY()
 	
@@ -31,6 +50,21 @@ public:
 	virtual void Tick(float DeltaTime) override;
 	//~End of UObject overridden functions
 
+	//~AActor overridden functions
+	virtual void K2_DestroyActor() override;
+	//~End of AActor overridden functions
+
+	//~IAccelByteWarsPoolableActorInterface overridden functions
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+	virtual void OnOwnerReleasedToPool(AActor* InOwner) override;
+	//~End of IAccelByteWarsPoolableActorInterface overridden functions
+
+	/**
+	 * @brief Gives the trail back to the actor pool, or destroys it if it can't be pooled
+	 */
+	void ReleaseOrDestroy();
+
 
 	/**
 	 * @brief Current reference to the UNiagaraComponent missile trail
@@ -93,4 +127,36 @@ protected:
 	 */
 	UFUNCTION()
 		void OnRepNotify_Color();
+
+	/**
+	 * @brief Generic on rep notify for the pooled trail being reused or released
+	 */
+	UFUNCTION()
+		void OnRepNotify_Activation();
+
+	/**
+	 * @brief Called every time a pooled trail is used again, after its state is reset. BeginPlay only runs on the first use.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = AccelByteWars)
+		void OnTrailReset();
+
+	/**
+	 * @brief Fades the trail out when the missile it follows is destroyed
+	 */
+	UFUNCTION()
+		void OnOwnerDestroyed(AActor* DestroyedActor);
+
+	/**
+	 * @brief Clears the ribbon history, restores the spawn alpha and redoes the per use setup of the blueprint BeginPlay:
+	 * fade out when the owner is destroyed or after MaximumLifetime. Then calls OnTrailReset.
+	 */
+	void ResetTrail();
+
+	UPROPERTY(ReplicatedUsing = OnRepNotify_Activation)
+		FAccelByteWarsMissileTrailActivation Activation;
+
+	/**
+	 * @brief Activation.Count this instance has applied locally
+	 */
+	int32 AppliedActivationCount = 0;
 };
@@ -0,0 +1,1039 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Containers/Ticker.h"
+#include "Core/Actor/AccelByteWarsMissile.h"
+#include "Core/GameModes/AccelByteWarsDiskPlacement.h"
+#include "Core/GameModes/AccelByteWarsInGameGameMode.h"
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Core/GameStates/AccelByteWarsPlayerIndex.h"
+#include "Core/Player/AccelByteWarsPlayerPawn.h"
+#include "Core/System/AccelByteWarsActorPoolSubsystem.h"
+#include "Core/System/AccelByteWarsClassRegistrySubsystem.h"
+#include "Core/System/AccelByteWarsFrameBudgetSubsystem.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
+#include "Core/System/AccelByteWarsMissileSubsystem.h"
+#include "Core/PowerUps/PowerUpByteShield.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAccelByteWarsBenchmark, Log, All);
+
+#define BENCHMARK_LOG(Verbosity, Format, ...) \
+{ \
+	UE_LOG(LogAccelByteWarsBenchmark, Verbosity, TEXT("%s"), *FString::Printf(Format, ##__VA_ARGS__)); \
+}
+
+/**
+ * Match access shared by the benchmark console commands. Benchmarks build their own data next to the match, the few that
+ * change a match setting to measure it (actor pool, idle server tick rate) restore it when done.
+ * Run on the machine that has authority, e.g. the server console or a standalone game.
+ */
+class FAccelByteWarsBenchmarkFixture
+{
+public:
+	FAccelByteWarsBenchmarkFixture(UWorld* InWorld, const TArray<FString>& InArgs)
+		: World(InWorld)
+		, Args(InArgs)
+	{
+		GameMode = World ? Cast<AAccelByteWarsInGameGameMode>(World->GetAuthGameMode()) : nullptr;
+		GameState = World ? World->GetGameState<AAccelByteWarsInGameGameState>() : nullptr;
+	}
+
+	/**
+	 * @brief Whether the world runs an in-game match with authority, logs why not
+	 */
+	bool IsValid() const
+	{
+		if (!GameMode || !GameState)
+		{
+			BENCHMARK_LOG(Warning, TEXT("No in-game match with authority in this world. Operation cancelled"));
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Positive integer argument at Index, Default if missing or not positive
+	 */
+	int32 GetIntArg(const int32 Index, const int32 Default) const
+	{
+		const int32 Value = Args.IsValidIndex(Index) ? FCString::Atoi(*Args[Index]) : 0;
+		return Value > 0 ? Value : Default;
+	}
+
+	/**
+	 * @brief First player pawn in the match, logs a warning if there is none
+	 */
+	AAccelByteWarsPlayerPawn* FindPlayerPawn() const
+	{
+		for (const APlayerState* PlayerState : GameState->PlayerArray)
+		{
+			if (AAccelByteWarsPlayerPawn* Pawn = PlayerState ? Cast<AAccelByteWarsPlayerPawn>(PlayerState->GetPawn()) : nullptr)
+			{
+				return Pawn;
+			}
+		}
+
+		BENCHMARK_LOG(Warning, TEXT("No player pawn in the match. Operation cancelled"));
+		return nullptr;
+	}
+
+	/**
+	 * @brief Class default object of the pawn the game mode spawns, logs a warning if it can't be loaded
+	 */
+	const AAccelByteWarsPlayerPawn* FindPawnTemplate() const
+	{
+		UAccelByteWarsClassRegistrySubsystem* ClassRegistry = World->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+		const UClass* PawnClass = ClassRegistry != nullptr ? ClassRegistry->FindOrLoadClass(GameMode->PawnBlueprintPath) : nullptr;
+
+		if (PawnClass == nullptr || !PawnClass->IsChildOf(AAccelByteWarsPlayerPawn::StaticClass()))
+		{
+			BENCHMARK_LOG(Warning, TEXT("Player pawn class not found. Operation cancelled"));
+			return nullptr;
+		}
+		return PawnClass->GetDefaultObject<AAccelByteWarsPlayerPawn>();
+	}
+
+	/**
+	 * @brief Class default object of the missile the pawn fires, logs a warning if it can't be loaded
+	 */
+	const AAccelByteWarsMissile* FindMissileTemplate(const AAccelByteWarsPlayerPawn* PawnTemplate) const
+	{
+		UAccelByteWarsClassRegistrySubsystem* ClassRegistry = World->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+		const UClass* MissileClass = ClassRegistry != nullptr ? ClassRegistry->FindOrLoadClass(PawnTemplate->FiredMissileBlueprintPath) : nullptr;
+
+		if (MissileClass == nullptr || !MissileClass->IsChildOf(AAccelByteWarsMissile::StaticClass())
+			|| MissileClass->GetDefaultObject<AAccelByteWarsMissile>()->AccelByteWarsGameplayObjectComponent == nullptr)
+		{
+			BENCHMARK_LOG(Warning, TEXT("Fired missile class not found. Operation cancelled"));
+			return nullptr;
+		}
+		return MissileClass->GetDefaultObject<AAccelByteWarsMissile>();
+	}
+
+	/**
+	 * @brief Area the game mode spawns planets in
+	 */
+	void GetPlanetSpawnArea(FVector2D& OutMinBound, FVector2D& OutMaxBound) const
+	{
+		GameMode->GetPlanetSpawnArea(OutMinBound, OutMaxBound);
+	}
+
+	/**
+	 * @brief Initialize Placement the way the game mode does before spawning planets
+	 */
+	void SetupPlanetPlacement(FAccelByteWarsDiskPlacement& Placement, const FVector2D& MinBound, const FVector2D& MaxBound) const
+	{
+		GameMode->SetupPlanetPlacement(Placement, MinBound, MaxBound);
+	}
+
+	/**
+	 * @brief One of the planets the game mode can spawn
+	 */
+	const FPlanetMetadata& GetRandomPlanet(FRandomStream& Random) const
+	{
+		return GameMode->GetPlanetMap().FindChecked(Random.RandRange(0, GameMode->GetPlanetMap().Num() - 1));
+	}
+
+	/**
+	 * @brief Packs planets into the planet spawn area with a small gap, denser than a match ever gets
+	 * @param OutBodies X, Y center and Z radius of every planet placed
+	 */
+	void PlaceDensePlanets(const int32 NumPlanets, FRandomStream& Random, TArray<FVector>& OutBodies) const
+	{
+		FVector2D MinBound;
+		FVector2D MaxBound;
+		GetPlanetSpawnArea(MinBound, MaxBound);
+
+		FAccelByteWarsDiskPlacement Placement;
+		Placement.Init(MinBound, MaxBound, 225.0f, 50.0f);
+		for (int32 i = 0; i < NumPlanets; ++i)
+		{
+			const float PlanetRadius = GetRandomPlanet(Random).PlanetRadius;
+			FVector2D PlanetCenter;
+			if (Placement.PlaceDisk(PlanetRadius, Random, PlanetCenter))
+			{
+				OutBodies.Add(FVector(PlanetCenter.X, PlanetCenter.Y, PlanetRadius));
+			}
+		}
+	}
+
+	/**
+	 * @brief Uniformly random location in the game bound
+	 */
+	FVector2D GetRandomLocation(FRandomStream& Random) const
+	{
+		return FVector2D(
+			FMath::Lerp(GameState->MinGameBound.X, GameState->MaxGameBound.X, Random.GetFraction()),
+			FMath::Lerp(GameState->MinGameBound.Y, GameState->MaxGameBound.Y, Random.GetFraction()));
+	}
+
+	UWorld* World = nullptr;
+	AAccelByteWarsInGameGameMode* GameMode = nullptr;
+	AAccelByteWarsInGameGameState* GameState = nullptr;
+
+private:
+	const TArray<FString>& Args;
+};
+
+/**
+ * @brief Logs how many candidate shots per millisecond the missile trajectory prediction evaluates
+ * Args: NumShots (spread over every aim direction and fire power level), NumSteps (simulation steps per shot)
+ */
+static void BenchmarkTrajectoryPrediction(const TArray<FString>& Args, UWorld* World)
+{
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	AAccelByteWarsPlayerPawn* Pawn = Fixture.FindPlayerPawn();
+	if (!Pawn)
+	{
+		return;
+	}
+
+	const int32 NumShots = Fixture.GetIntArg(0, 500);
+	const int32 NumSteps = Fixture.GetIntArg(1, 600);
+
+	FAccelByteWarsMissileTrajectory Trajectory;
+	int32 NumHits = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumShots; ++i)
+	{
+		const float Alpha = static_cast<float>(i) / NumShots;
+		const FRotator AimRotation(0.0f, Alpha * 360.0f, 0.0f);
+		const float PowerLevel = FMath::Frac(Alpha * 7.0f);
+
+		if (Pawn->PredictMissileTrajectory(AimRotation, PowerLevel, NumSteps, Trajectory) && Trajectory.HitObject)
+		{
+			NumHits++;
+		}
+	}
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	BENCHMARK_LOG(Log, TEXT("Trajectory prediction: %d shots x %d steps in %.3f ms, %.2f shots/ms, %d hits"),
+		NumShots, NumSteps, ElapsedMs, NumShots / FMath::Max(ElapsedMs, 0.001), NumHits);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkTrajectoryPredictionCommand(
+	TEXT("AccelByteWars.Benchmark.TrajectoryPrediction"),
+	TEXT("[NumShots=500] [NumSteps=600] Log how many candidate shots per millisecond the missile trajectory prediction evaluates"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkTrajectoryPrediction));
+
+/**
+ * @brief Logs the cost of a byte shield collision check, next to a full actor list scan for missiles
+ * Args: NumUnrelatedActors (spawned into the level for the duration of the benchmark), NumTicks (collision checks measured)
+ */
+static void BenchmarkShieldCollision(const TArray<FString>& Args, UWorld* World)
+{
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	AAccelByteWarsPlayerPawn* Pawn = Fixture.FindPlayerPawn();
+	if (!Pawn)
+	{
+		return;
+	}
+
+	const int32 NumUnrelatedActors = Fixture.GetIntArg(0, 200);
+	const int32 NumTicks = Fixture.GetIntArg(1, 1000);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	TArray<AActor*> UnrelatedActors;
+	for (int32 i = 0; i < NumUnrelatedActors; ++i)
+	{
+		UnrelatedActors.Add(World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters));
+	}
+
+	// Far outside the play area, no missile can reach the shield
+	SpawnParameters.Owner = Pawn;
+	const FVector ShieldLocation(Fixture.GameState->MaxGameBoundExtend.X * 10.0f, Fixture.GameState->MaxGameBoundExtend.Y * 10.0f, 0.0f);
+	APowerUpByteShield* Shield = World->SpawnActor<APowerUpByteShield>(APowerUpByteShield::StaticClass(), FTransform(ShieldLocation), SpawnParameters);
+
+	if (Shield)
+	{
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumTicks; ++i)
+		{
+			Shield->CheckCollision();
+		}
+		const double RegistryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		StartTime = FPlatformTime::Seconds();
+		TArray<AActor*> FoundMissiles;
+		for (int32 i = 0; i < NumTicks; ++i)
+		{
+			UGameplayStatics::GetAllActorsOfClass(World, AAccelByteWarsMissile::StaticClass(), FoundMissiles);
+		}
+		const double ActorScanMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		BENCHMARK_LOG(Log, TEXT("Shield collision: %d unrelated actors, %.4f ms per check, %.4f ms per actor list scan"),
+			NumUnrelatedActors, RegistryMs / NumTicks, ActorScanMs / NumTicks);
+
+		Shield->Destroy();
+	}
+
+	for (AActor* Actor : UnrelatedActors)
+	{
+		if (Actor)
+		{
+			Actor->Destroy();
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkShieldCollisionCommand(
+	TEXT("AccelByteWars.Benchmark.ShieldCollision"),
+	TEXT("[NumUnrelatedActors=200] [NumTicks=1000] Log the cost of a byte shield collision check next to an actor list scan"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkShieldCollision));
+
+/**
+ * @brief Logs the cost of a player lookup for 8 to 64 synthetic players across 16 teams, for known and unknown players.
+ * Uses its own teams and index, the match is not needed.
+ * Args: NumLookups (lookups measured per player count)
+ */
+static void BenchmarkPlayerLookup(const TArray<FString>& Args, UWorld* World)
+{
+	constexpr int32 NumTeams = 16;
+
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	const int32 NumLookups = Fixture.GetIntArg(0, 100000);
+
+	for (int32 NumPlayers = 8; NumPlayers <= 64; NumPlayers *= 2)
+	{
+		// local players only have a controller id
+		TArray<FGameplayTeamData> Teams;
+		for (int32 TeamId = 0; TeamId < NumTeams; ++TeamId)
+		{
+			Teams.Add(FGameplayTeamData{TeamId});
+		}
+		for (int32 i = 0; i < NumPlayers; ++i)
+		{
+			FGameplayPlayerData PlayerData;
+			PlayerData.ControllerId = i;
+			PlayerData.TeamId = i % NumTeams;
+			Teams[PlayerData.TeamId].TeamMembers.Add(PlayerData);
+		}
+		FAccelByteWarsPlayerIndex PlayerIndex;
+
+		int32 NumFound = 0;
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < NumLookups; ++i)
+		{
+			NumFound += PlayerIndex.Find(Teams, FUniqueNetIdRepl(), i % NumPlayers) ? 1 : 0;
+		}
+		const double KnownNs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000000.0 / NumLookups;
+
+		// players that are not in the teams, e.g. still logging in or already gone
+		StartCycles = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < NumLookups; ++i)
+		{
+			NumFound += PlayerIndex.Find(Teams, FUniqueNetIdRepl(), NumPlayers + i % NumPlayers) ? 1 : 0;
+		}
+		const double UnknownNs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000000.0 / NumLookups;
+
+		BENCHMARK_LOG(Log, TEXT("Player lookup: %d players in %d teams, %.1f ns per known lookup, %.1f ns per unknown lookup, %d / %d found"),
+			NumPlayers, NumTeams, KnownNs, UnknownNs, NumFound, NumLookups);
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkPlayerLookupCommand(
+	TEXT("AccelByteWars.Benchmark.PlayerLookup"),
+	TEXT("[NumLookups=100000] Log the cost of a player data lookup for 8 to 64 synthetic players"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkPlayerLookup));
+
+/**
+ * @brief Logs the time and the share of bodies that found no room when placing 6, 50 and 500 planets in the planet spawn area
+ * Args: NumRuns (placements measured per body count)
+ */
+static void BenchmarkPlanetPlacement(const TArray<FString>& Args, UWorld* World)
+{
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	const int32 NumRuns = Fixture.GetIntArg(0, 100);
+
+	FVector2D MinBound;
+	FVector2D MaxBound;
+	Fixture.GetPlanetSpawnArea(MinBound, MaxBound);
+
+	FRandomStream Random(NumRuns);
+	FAccelByteWarsDiskPlacement Placement;
+
+	for (const int32 NumBodies : {6, 50, 500})
+	{
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+		int32 NumFailed = 0;
+
+		for (int32 Run = 0; Run < NumRuns; ++Run)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Fixture.SetupPlanetPlacement(Placement, MinBound, MaxBound);
+			for (int32 i = 0; i < NumBodies; ++i)
+			{
+				FVector2D Position2D;
+				if (!Placement.PlaceDisk(Fixture.GetRandomPlanet(Random).PlanetRadius, Random, Position2D))
+				{
+					NumFailed++;
+				}
+			}
+			const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			TotalMs += ElapsedMs;
+			MaxMs = FMath::Max(MaxMs, ElapsedMs);
+		}
+
+		BENCHMARK_LOG(Log, TEXT("Planet placement: %d bodies, %.3f ms avg, %.3f ms max, %.1f%% not placed"),
+			NumBodies, TotalMs / NumRuns, MaxMs, 100.0 * NumFailed / (NumBodies * NumRuns));
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkPlanetPlacementCommand(
+	TEXT("AccelByteWars.Benchmark.PlanetPlacement"),
+	TEXT("[NumRuns=100] Log the time and the share of bodies not placed when placing 6, 50 and 500 planets"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkPlanetPlacement));
+
+/**
+ * @brief Logs p50/p99 spawn location query latency and the fallback rate for 32 synthetic ships among densely placed planets.
+ * Uses a standalone grid, the match is not modified.
+ * Args: NumQueries (queries measured, spread over the four ship quadrants)
+ */
+static void BenchmarkSpawnLocation(const TArray<FString>& Args, UWorld* World)
+{
+	constexpr int32 NumShips = 32;
+	constexpr int32 NumPlanets = 40;
+	constexpr float ShipRadius = 50.0f;
+
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	const int32 NumQueries = Fixture.GetIntArg(0, 10000);
+	const float ObjectSafeDistance = Fixture.GameMode->ObjectSafeDistance;
+	const FVector2D MinBound = Fixture.GameState->MinGameBound;
+	const FVector2D MaxBound = Fixture.GameState->MaxGameBound;
+	const FVector2D Center = (MinBound + MaxBound) / 2.0;
+	FRandomStream Random(NumQueries);
+
+	// each planet blocks ObjectSafeDistance around it
+	TArray<FVector> Bodies;
+	Fixture.PlaceDensePlanets(NumPlanets, Random, Bodies);
+
+	FAccelByteWarsSpawnLocationGrid Grid;
+	Grid.Init(MinBound, MaxBound, Fixture.GameMode->SpawnLocationGridCellSize);
+	for (int32 i = 0; i < Bodies.Num(); ++i)
+	{
+		// the key only identifies the blocker
+		Grid.AddBlocker(reinterpret_cast<const void*>(static_cast<UPTRINT>(i + 1)), FVector2D(Bodies[i]), Bodies[i].Z + ObjectSafeDistance);
+	}
+
+	TArray<FVector2D> Ships;
+	for (int32 i = 0; i < NumShips; ++i)
+	{
+		Ships.Add(Fixture.GetRandomLocation(Random));
+	}
+	const auto IsAwayFromSyntheticShips = [&Ships, ObjectSafeDistance](const FVector2D& Location)
+	{
+		for (const FVector2D& Ship : Ships)
+		{
+			if (FVector2D::DistSquared(Location, Ship) < FMath::Square(ShipRadius + ObjectSafeDistance))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// query the four quadrants in turn, like ship respawns do
+	const FBox2D Quadrants[4] = {
+		FBox2D(FVector2D(MinBound.X, Center.Y), FVector2D(Center.X, MaxBound.Y)),
+		FBox2D(Center, MaxBound),
+		FBox2D(MinBound, Center),
+		FBox2D(FVector2D(Center.X, MinBound.Y), FVector2D(MaxBound.X, Center.Y))
+	};
+
+	TArray<double> LatenciesUs;
+	LatenciesUs.Reserve(NumQueries);
+	int32 NumFallbacks = 0;
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		const FBox2D& Quadrant = Quadrants[i % 4];
+		FVector2D Location;
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		if (!Grid.FindLocation(Quadrant.Min, Quadrant.Max, IsAwayFromSyntheticShips, Random, Location))
+		{
+			NumFallbacks++;
+		}
+		LatenciesUs.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+	}
+
+	LatenciesUs.Sort();
+	BENCHMARK_LOG(Log, TEXT("Spawn location: %d ships, %d planets, p50 %.2f us, p99 %.2f us, %.1f%% fallback"),
+		NumShips,
+		Bodies.Num(),
+		LatenciesUs[LatenciesUs.Num() / 2],
+		LatenciesUs[FMath::Min(LatenciesUs.Num() - 1, LatenciesUs.Num() * 99 / 100)],
+		100.0 * NumFallbacks / NumQueries);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkSpawnLocationCommand(
+	TEXT("AccelByteWars.Benchmark.SpawnLocation"),
+	TEXT("[NumQueries=10000] Log p50/p99 spawn location query latency and the fallback rate among densely placed planets"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkSpawnLocation));
+
+/**
+ * @brief Logs how many ship line of sight checks per millisecond run for 32 synthetic ships among densely placed planets
+ * Args: NumChecks (checks measured, each one from a random location against every ship)
+ */
+static void BenchmarkLineOfSight(const TArray<FString>& Args, UWorld* World)
+{
+	constexpr int32 NumShips = 32;
+	constexpr int32 NumPlanets = 40;
+
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	const int32 NumChecks = Fixture.GetIntArg(0, 10000);
+	FRandomStream Random(NumChecks);
+
+	TArray<FVector> Bodies;
+	Fixture.PlaceDensePlanets(NumPlanets, Random, Bodies);
+
+	TArray<FVector> Ships;
+	for (int32 i = 0; i < NumShips; ++i)
+	{
+		Ships.Add(FVector(Fixture.GetRandomLocation(Random), 50.0f));
+	}
+
+	TArray<FVector2D> Locations;
+	Locations.Reserve(NumChecks);
+	for (int32 i = 0; i < NumChecks; ++i)
+	{
+		Locations.Add(Fixture.GetRandomLocation(Random));
+	}
+
+	int32 NumInSight = 0;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (const FVector2D& Location : Locations)
+	{
+		NumInSight += AAccelByteWarsInGameGameMode::HasLineOfSightToAny(Location, Ships, Bodies) ? 1 : 0;
+	}
+	const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	BENCHMARK_LOG(Log, TEXT("Line of sight: %d ships, %d planets, %.0f checks per ms, %.1f%% in sight"),
+		NumShips,
+		Bodies.Num(),
+		NumChecks / FMath::Max(Ms, UE_KINDA_SMALL_NUMBER),
+		100.0 * NumInSight / NumChecks);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkLineOfSightCommand(
+	TEXT("AccelByteWars.Benchmark.LineOfSight"),
+	TEXT("[NumChecks=10000] Log how many ship line of sight checks per millisecond run among densely placed planets"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkLineOfSight));
+
+/**
+ * @brief Logs the per frame cost of the missile gravity and hit queries at 8, 64 and 512 live missiles, through the game
+ * state's broadphase and through a scan of every active game object like the former per-actor missile Tick.
+ * Missiles are synthetic points flying through the match's objects with the live step size, 60 frames per second.
+ * Only the queries are measured, actors are not spawned and the match is not modified.
+ * Args: NumFrames (frames simulated per missile count)
+ */
+static void BenchmarkMissileQueries(const TArray<FString>& Args, UWorld* World)
+{
+	constexpr float FrameSeconds = 1.0f / 60.0f;
+
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	const AAccelByteWarsPlayerPawn* PawnTemplate = Fixture.FindPawnTemplate();
+	const AAccelByteWarsMissile* MissileTemplate = PawnTemplate != nullptr ? Fixture.FindMissileTemplate(PawnTemplate) : nullptr;
+	if (MissileTemplate == nullptr)
+	{
+		return;
+	}
+
+	AAccelByteWarsInGameGameState* GameState = Fixture.GameState;
+	const int32 NumFrames = Fixture.GetIntArg(0, 600);
+	const float StepSeconds = FMath::Max(GetDefault<UAccelByteWarsMissileSubsystem>()->FixedStepSeconds, KINDA_SMALL_NUMBER);
+	const int32 NumStepsPerFrame = FMath::Max(FMath::RoundToInt(FrameSeconds / StepSeconds), 1);
+	const float Mass = MissileTemplate->AccelByteWarsGameplayObjectComponent->Mass;
+	const float Radius = MissileTemplate->AccelByteWarsGameplayObjectComponent->Radius;
+	const float QueryRadius = MissileTemplate->GetNearbyQueryRadius();
+
+	TArray<UAccelByteWarsGameplayObjectComponent*> NearbyObjects;
+	int32 NumHits = 0;
+
+	// Same hit rule as AAccelByteWarsMissile::DetectHitObjectsAt
+	const auto HasHitAny = [Radius](const TArray<UAccelByteWarsGameplayObjectComponent*>& Objects, const FVector& Location)
+	{
+		bool bHasHit = false;
+		for (const UAccelByteWarsGameplayObjectComponent* Object : Objects)
+		{
+			if (Object != nullptr && Object->GetOwner() != nullptr
+				&& FVector::Distance(Object->GetOwner()->GetActorLocation(), Location) / 100.0f < Radius + Object->Radius)
+			{
+				bHasHit = true;
+			}
+		}
+		return bHasHit;
+	};
+
+	for (const int32 NumMissiles : {8, 64, 512})
+	{
+		for (const bool bUseBroadphase : {true, false})
+		{
+			FRandomStream Random(NumMissiles);
+			TArray<FVector> Positions;
+			TArray<FVector> Velocities;
+			for (int32 i = 0; i < NumMissiles; ++i)
+			{
+				Positions.Add(FVector(Fixture.GetRandomLocation(Random), 0.0f));
+				const float Speed = FMath::Lerp(PawnTemplate->MinMissileSpeed, PawnTemplate->MaxMissileSpeed, Random.GetFraction());
+				Velocities.Add(FRotator(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f).Vector() * Speed);
+			}
+
+			NumHits = 0;
+			uint64 QueryCycles = 0;
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				for (int32 Step = 0; Step < NumStepsPerFrame; ++Step)
+				{
+					for (int32 i = 0; i < NumMissiles; ++i)
+					{
+						FVector Force = FVector::ZeroVector;
+						bool bHasHit = false;
+
+						const uint64 StartCycles = FPlatformTime::Cycles64();
+						if (bUseBroadphase)
+						{
+							Force = AAccelByteWarsMissile::CalculateGravityForce(GameState, Positions[i], Mass, MissileTemplate->GravitationalConstant);
+
+							NearbyObjects.Reset();
+							GameState->GetGameObjectsNearLocation(Positions[i], QueryRadius, NearbyObjects);
+							bHasHit = HasHitAny(NearbyObjects, Positions[i]);
+						}
+						else
+						{
+							for (const UAccelByteWarsGameplayObjectComponent* Object : GameState->ActiveGameObjects)
+							{
+								float Distance = 0.0f;
+								FVector ObjectForce = FVector::ZeroVector;
+								if (AAccelByteWarsMissile::CalculateGravityForceToObject(Positions[i], Mass, MissileTemplate->GravitationalConstant, Object, Distance, ObjectForce))
+								{
+									Force = ObjectForce + Force;
+								}
+							}
+							bHasHit = HasHitAny(GameState->ActiveGameObjects, Positions[i]);
+						}
+						QueryCycles += FPlatformTime::Cycles64() - StartCycles;
+
+						Velocities[i] = Velocities[i] + ((Force / Mass) * StepSeconds);
+						Positions[i] = Positions[i] + (StepSeconds * Velocities[i]);
+						NumHits += bHasHit ? 1 : 0;
+
+						// keep the number of missiles in flight constant, a missile that hit something or left the bound is fired again
+						if (bHasHit
+							|| Positions[i].X <= GameState->MinGameBoundExtend.X || Positions[i].X >= GameState->MaxGameBoundExtend.X
+							|| Positions[i].Y <= GameState->MinGameBoundExtend.Y || Positions[i].Y >= GameState->MaxGameBoundExtend.Y)
+						{
+							Positions[i] = FVector(Fixture.GetRandomLocation(Random), 0.0f);
+						}
+					}
+				}
+			}
+
+			BENCHMARK_LOG(Log, TEXT("Missile queries (%s): %d missiles, %d objects, %d steps per frame, %.4f ms per frame, %d hits"),
+				bUseBroadphase ? TEXT("broadphase") : TEXT("full scan"),
+				NumMissiles,
+				GameState->ActiveGameObjects.Num(),
+				NumStepsPerFrame,
+				FPlatformTime::ToMilliseconds64(QueryCycles) / NumFrames,
+				NumHits);
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkMissileQueriesCommand(
+	TEXT("AccelByteWars.Benchmark.MissileQueries"),
+	TEXT("[NumFrames=600] Log the per frame cost of missile gravity and hit queries at 8, 64 and 512 missiles, broadphase and full scan"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkMissileQueries));
+
+/**
+ * @brief Compares the missile subsystem's fixed substeps with the former per-actor missile Tick for seeded shots: how often both
+ * end the same way (same object hit, out of bounds or timed out), how far apart the end points and the paths are, and the cost.
+ * The former Tick is replayed as it was: one step per frame, gravity and hits over every active game object, then velocity and
+ * location. Only the math is compared, the cost of ticking one actor per missile is not included.
+ * Args: NumShots (shots fired from random locations in random directions), TickRate (frames per second of the former Tick)
+ */
+static void BenchmarkMissileStep(const TArray<FString>& Args, UWorld* World)
+{
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	const AAccelByteWarsPlayerPawn* PawnTemplate = Fixture.FindPawnTemplate();
+	const AAccelByteWarsMissile* MissileTemplate = PawnTemplate != nullptr ? Fixture.FindMissileTemplate(PawnTemplate) : nullptr;
+	if (MissileTemplate == nullptr)
+	{
+		return;
+	}
+
+	AAccelByteWarsInGameGameState* GameState = Fixture.GameState;
+	const int32 NumShots = Fixture.GetIntArg(0, 64);
+	const float FrameSeconds = 1.0f / Fixture.GetIntArg(1, 60);
+	const float StepSeconds = FMath::Max(GetDefault<UAccelByteWarsMissileSubsystem>()->FixedStepSeconds, KINDA_SMALL_NUMBER);
+	const float Mass = MissileTemplate->AccelByteWarsGameplayObjectComponent->Mass;
+	const float Radius = MissileTemplate->AccelByteWarsGameplayObjectComponent->Radius;
+	const int32 MaxSubsteps = FMath::CeilToInt(MissileTemplate->MaxTimeAlive / StepSeconds) + 1;
+
+	FRandomStream Random(NumShots);
+	FAccelByteWarsMissileTrajectory Trajectory;
+	int32 NumSameOutcomes = 0;
+	double SumEndDistance = 0.0;
+	double MaxEndDistance = 0.0;
+	double MaxPathDistance = 0.0;
+	double LegacyFlightSeconds = 0.0;
+	double SubstepFlightSeconds = 0.0;
+	uint64 LegacyCycles = 0;
+	uint64 SubstepCycles = 0;
+
+	for (int32 Shot = 0; Shot < NumShots; ++Shot)
+	{
+		const FVector StartLocation(Fixture.GetRandomLocation(Random), 0.0f);
+		const float Speed = FMath::Lerp(PawnTemplate->MinMissileSpeed, PawnTemplate->MaxMissileSpeed, Random.GetFraction());
+		const FVector StartVelocity = FRotator(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f).Vector() * Speed;
+
+		uint64 StartCycles = FPlatformTime::Cycles64();
+		AAccelByteWarsMissile::PredictTrajectory(GameState, MissileTemplate, StartLocation, StartVelocity, MaxSubsteps, Trajectory);
+		SubstepCycles += FPlatformTime::Cycles64() - StartCycles;
+		SubstepFlightSeconds += Trajectory.FlightTime;
+
+		// Former Tick: ApplyGravityToThisGameObjects, ApplyOverallGravityForceToChangeTheVelocity, then the destroy rules
+		FVector Location = StartLocation;
+		FVector CurrentVelocity = StartVelocity;
+		const UAccelByteWarsGameplayObjectComponent* LegacyHitObject = nullptr;
+		bool bLegacyOutOfBounds = false;
+		float FlightTime = 0.0f;
+
+		StartCycles = FPlatformTime::Cycles64();
+		while (LegacyHitObject == nullptr && !bLegacyOutOfBounds && FlightTime <= MissileTemplate->MaxTimeAlive)
+		{
+			FVector Force = FVector::ZeroVector;
+			for (const UAccelByteWarsGameplayObjectComponent* Object : GameState->ActiveGameObjects)
+			{
+				float Distance = 0.0f;
+				FVector ObjectForce = FVector::ZeroVector;
+				if (AAccelByteWarsMissile::CalculateGravityForceToObject(Location, Mass, MissileTemplate->GravitationalConstant, Object, Distance, ObjectForce))
+				{
+					Force = ObjectForce + Force;
+					if (Distance / 100.0f < Radius + Object->Radius)
+					{
+						LegacyHitObject = Object;
+					}
+				}
+			}
+			if (LegacyHitObject != nullptr)
+			{
+				break;
+			}
+
+			CurrentVelocity = CurrentVelocity + ((Force / Mass) * FrameSeconds);
+			Location = Location + (FrameSeconds * CurrentVelocity);
+			FlightTime += FrameSeconds;
+
+			bLegacyOutOfBounds = Location.X <= GameState->MinGameBoundExtend.X || Location.X >= GameState->MaxGameBoundExtend.X
+				|| Location.Y <= GameState->MinGameBoundExtend.Y || Location.Y >= GameState->MaxGameBoundExtend.Y;
+
+			// Same flight time on the substep path, both paths are stored from the start location
+			const int32 SubstepIndex = FMath::RoundToInt(FlightTime / StepSeconds);
+			if (Trajectory.Locations.IsValidIndex(SubstepIndex))
+			{
+				MaxPathDistance = FMath::Max(MaxPathDistance, FVector::Distance(Location, Trajectory.Locations[SubstepIndex]));
+			}
+		}
+		LegacyCycles += FPlatformTime::Cycles64() - StartCycles;
+		LegacyFlightSeconds += FlightTime;
+
+		const bool bLegacyTimedOut = LegacyHitObject == nullptr && !bLegacyOutOfBounds;
+		const bool bSubstepTimedOut = Trajectory.HitObject == nullptr && !Trajectory.bOutOfBounds;
+		if (LegacyHitObject == Trajectory.HitObject && bLegacyOutOfBounds == Trajectory.bOutOfBounds && bLegacyTimedOut == bSubstepTimedOut)
+		{
+			NumSameOutcomes++;
+		}
+
+		const double EndDistance = Trajectory.Locations.IsEmpty() ? 0.0 : FVector::Distance(Location, Trajectory.Locations.Last());
+		SumEndDistance += EndDistance;
+		MaxEndDistance = FMath::Max(MaxEndDistance, EndDistance);
+	}
+
+	BENCHMARK_LOG(Log, TEXT("Missile step: %d shots, %.1f%% same outcome, end point %.1f avg %.1f max, path %.1f max (unreal units)"),
+		NumShots, 100.0 * NumSameOutcomes / NumShots, SumEndDistance / NumShots, MaxEndDistance, MaxPathDistance);
+	BENCHMARK_LOG(Log, TEXT("Missile step: former Tick at %.0f Hz %.4f ms, substeps of %.2f ms %.4f ms, per missile per second of flight"),
+		1.0f / FrameSeconds,
+		FPlatformTime::ToMilliseconds64(LegacyCycles) / FMath::Max(LegacyFlightSeconds, UE_KINDA_SMALL_NUMBER),
+		StepSeconds * 1000.0f,
+		FPlatformTime::ToMilliseconds64(SubstepCycles) / FMath::Max(SubstepFlightSeconds, UE_KINDA_SMALL_NUMBER));
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkMissileStepCommand(
+	TEXT("AccelByteWars.Benchmark.MissileStep"),
+	TEXT("[NumShots=64] [TickRate=60] Compare outcomes, paths and cost of the missile substeps with the former per-actor missile Tick"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkMissileStep));
+
+/**
+ * @brief Logs how many missiles a volley spawns and how long acquiring and releasing it takes, with the actor pool disabled then
+ * enabled. Released missiles that the pool doesn't keep are destroyed, their garbage collection is not included.
+ * Args: NumVolleys (volleys fired one after the other), VolleySize (missiles per volley, every player's missile limit by default)
+ */
+static void BenchmarkMissilePool(const TArray<FString>& Args, UWorld* World)
+{
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	UAccelByteWarsActorPoolSubsystem* ActorPool = World->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+	const AAccelByteWarsPlayerPawn* PawnTemplate = Fixture.FindPawnTemplate();
+	const AAccelByteWarsMissile* MissileTemplate = PawnTemplate != nullptr ? Fixture.FindMissileTemplate(PawnTemplate) : nullptr;
+	if (ActorPool == nullptr || MissileTemplate == nullptr)
+	{
+		return;
+	}
+
+	const FGameModeData& GameSetup = Fixture.GameState->GameSetup;
+	const int32 NumVolleys = Fixture.GetIntArg(0, 20);
+	const int32 VolleySize = Fixture.GetIntArg(1, FMath::Max(GameSetup.FiredMissilesLimit * GameSetup.MaxPlayers, 1));
+	const FTransform Transform(FVector(Fixture.GameState->MaxGameBoundExtend, 0.0f));
+	const bool bWasEnabled = ActorPool->bEnabled;
+
+	for (const bool bPooled : {false, true})
+	{
+		ActorPool->bEnabled = bPooled;
+		if (bPooled)
+		{
+			ActorPool->PrewarmActors(MissileTemplate->GetClass(), VolleySize);
+		}
+
+		TSet<const AActor*> Instances;
+		TArray<AAccelByteWarsMissile*> Volley;
+		double SumVolleyMs = 0.0;
+		double MaxVolleyMs = 0.0;
+
+		for (int32 i = 0; i < NumVolleys; ++i)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 j = 0; j < VolleySize; ++j)
+			{
+				if (AAccelByteWarsMissile* Missile = ActorPool->AcquireActor<AAccelByteWarsMissile>(MissileTemplate->GetClass(), Transform, nullptr, nullptr))
+				{
+					Volley.Add(Missile);
+				}
+			}
+			for (AAccelByteWarsMissile* Missile : Volley)
+			{
+				Missile->ReleaseOrDestroy();
+			}
+			const double VolleyMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			SumVolleyMs += VolleyMs;
+			MaxVolleyMs = FMath::Max(MaxVolleyMs, VolleyMs);
+			Instances.Append(Volley);
+			Volley.Reset();
+		}
+
+		BENCHMARK_LOG(Log, TEXT("Missile pool %s: %d volleys of %d, %d missiles spawned, %.3f ms avg %.3f ms max per volley"),
+			bPooled ? TEXT("enabled") : TEXT("disabled"), NumVolleys, VolleySize, Instances.Num(), SumVolleyMs / NumVolleys, MaxVolleyMs);
+	}
+
+	ActorPool->bEnabled = bWasEnabled;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkMissilePoolCommand(
+	TEXT("AccelByteWars.Benchmark.MissilePool"),
+	TEXT("[NumVolleys=20] [VolleySize] Log missiles spawned and time per volley with the actor pool disabled then enabled"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkMissilePool));
+
+/**
+ * @brief Logs the average process CPU usage and tick rate of an idle dedicated server, first at its full tick rate then
+ * throttled to IdleServerTickRate. Runs in the background, one sample per second, and restores IdleServerTickRate after.
+ * Args: Seconds (length of each phase)
+ */
+static void BenchmarkIdleServerCpu(const TArray<FString>& Args, UWorld* World)
+{
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	UNetDriver* NetDriver = World->GetNetDriver();
+	if (!IsRunningDedicatedServer() || NetDriver == nullptr)
+	{
+		BENCHMARK_LOG(Warning, TEXT("Not a dedicated server. Operation cancelled"));
+		return;
+	}
+	if (Fixture.GameMode->IdleServerTickRate <= 0)
+	{
+		BENCHMARK_LOG(Warning, TEXT("IdleServerTickRate is 0, the server is never throttled. Operation cancelled"));
+		return;
+	}
+	if (!NetDriver->ClientConnections.IsEmpty())
+	{
+		BENCHMARK_LOG(Warning, TEXT("%d clients connected, the server is only throttled while none is or after the game ends"),
+			NetDriver->ClientConnections.Num());
+	}
+
+	struct FIdleServerCpuPhase
+	{
+		const TCHAR* Name = TEXT("");
+		int32 IdleServerTickRate = 0;
+		double CpuPctSum = 0.0;
+		int32 NumSamples = 0;
+		uint64 StartFrame = 0;
+	};
+
+	const int32 PhaseSeconds = Fixture.GetIntArg(0, 300);
+	const int32 ConfiguredTickRate = Fixture.GameMode->IdleServerTickRate;
+	const TWeakObjectPtr<AAccelByteWarsInGameGameMode> GameMode = Fixture.GameMode;
+	const TSharedRef<TArray<FIdleServerCpuPhase>> Phases = MakeShared<TArray<FIdleServerCpuPhase>>();
+	Phases->Add({TEXT("full tick rate"), 0});
+	Phases->Add({TEXT("throttled"), ConfiguredTickRate});
+	const TSharedRef<int32> PhaseIndex = MakeShared<int32>(0);
+
+	Fixture.GameMode->SetIdleServerTickRate((*Phases)[0].IdleServerTickRate);
+	(*Phases)[0].StartFrame = GFrameCounter;
+	BENCHMARK_LOG(Log, TEXT("Idle server CPU: %d s at the full tick rate, then %d s throttled to %d Hz"),
+		PhaseSeconds, PhaseSeconds, (*Phases)[1].IdleServerTickRate);
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([GameMode, Phases, PhaseIndex, PhaseSeconds, ConfiguredTickRate](float)
+	{
+		if (!GameMode.IsValid())
+		{
+			BENCHMARK_LOG(Warning, TEXT("Idle server CPU: the match ended. Operation cancelled"));
+			return false;
+		}
+
+		// process CPU usage over the last update interval of the platform
+		FIdleServerCpuPhase& Phase = (*Phases)[*PhaseIndex];
+		Phase.CpuPctSum += FPlatformTime::GetCPUTime().CPUTimePct;
+		Phase.NumSamples++;
+		if (Phase.NumSamples < PhaseSeconds)
+		{
+			return true;
+		}
+
+		BENCHMARK_LOG(Log, TEXT("Idle server CPU, %s: %.2f%% average, %.1f ticks per second"),
+			Phase.Name,
+			Phase.CpuPctSum / Phase.NumSamples,
+			static_cast<double>(GFrameCounter - Phase.StartFrame) / Phase.NumSamples);
+
+		if (++*PhaseIndex < Phases->Num())
+		{
+			FIdleServerCpuPhase& NextPhase = (*Phases)[*PhaseIndex];
+			GameMode->SetIdleServerTickRate(NextPhase.IdleServerTickRate);
+			NextPhase.StartFrame = GFrameCounter;
+			return true;
+		}
+
+		GameMode->SetIdleServerTickRate(ConfiguredTickRate);
+		return false;
+	}), 1.0f);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkIdleServerCpuCommand(
+	TEXT("AccelByteWars.Benchmark.IdleServerCpu"),
+	TEXT("[Seconds=300] Dedicated server only. Log average CPU usage and tick rate with no throttling, then throttled to IdleServerTickRate"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkIdleServerCpu));
+
+/**
+ * @brief Logs the game thread time the game mode spent in its Tick and game status updates over a period, e.g. on an idle
+ * dedicated server waiting for players: AccelByteWarsServer -nullrhi, then AccelByteWars.Benchmark.GameModeIdle 60
+ * Reads the GameModeTick and GameStatus frame scopes, which -FrameBudgetMs resets every frame.
+ * Args: Seconds (length of the period)
+ */
+static void BenchmarkGameModeIdle(const TArray<FString>& Args, UWorld* World)
+{
+	const FAccelByteWarsBenchmarkFixture Fixture(World, Args);
+	if (!Fixture.IsValid())
+	{
+		return;
+	}
+
+	float BudgetMs = 0.0f;
+	if (UAccelByteWarsFrameBudgetSubsystem::GetBudgetMs(BudgetMs))
+	{
+		BENCHMARK_LOG(Warning, TEXT("-FrameBudgetMs resets the frame scopes every frame. Operation cancelled"));
+		return;
+	}
+
+	const int32 Seconds = Fixture.GetIntArg(0, 60);
+	const TWeakObjectPtr<AAccelByteWarsInGameGameMode> GameMode = Fixture.GameMode;
+	const uint64 StartFrame = GFrameCounter;
+	const double StartTime = FPlatformTime::Seconds();
+	FAccelByteWarsFrameScopeTimer::ResetFrame();
+
+	BENCHMARK_LOG(Log, TEXT("Game mode idle: measuring %d s in %s, game mode tick %s"),
+		Seconds,
+		*UEnum::GetValueAsString(Fixture.GameState->GameStatus),
+		Fixture.GameMode->IsActorTickEnabled() ? TEXT("enabled") : TEXT("disabled"));
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([GameMode, StartFrame, StartTime](float)
+	{
+		if (!GameMode.IsValid())
+		{
+			BENCHMARK_LOG(Warning, TEXT("Game mode idle: the match ended. Operation cancelled"));
+			return false;
+		}
+
+		const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+		const double TickMs = FPlatformTime::ToMilliseconds64(FAccelByteWarsFrameScopeTimer::GetFrameCycles(EAccelByteWarsFrameScope::GameModeTick));
+		const double StatusMs = FPlatformTime::ToMilliseconds64(FAccelByteWarsFrameScopeTimer::GetFrameCycles(EAccelByteWarsFrameScope::GameStatus));
+		BENCHMARK_LOG(Log, TEXT("Game mode idle: %llu frames in %.1f s, Tick %.3f ms, game status %.3f ms, %.4f ms per second"),
+			GFrameCounter - StartFrame,
+			ElapsedSeconds,
+			TickMs,
+			StatusMs,
+			(TickMs + StatusMs) / FMath::Max(ElapsedSeconds, UE_KINDA_SMALL_NUMBER));
+		return false;
+	}), static_cast<float>(Seconds));
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkGameModeIdleCommand(
+	TEXT("AccelByteWars.Benchmark.GameModeIdle"),
+	TEXT("[Seconds=60] Log the game thread time of the game mode Tick and game status updates over the period"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkGameModeIdle));
+
+#endif // !UE_BUILD_SHIPPING
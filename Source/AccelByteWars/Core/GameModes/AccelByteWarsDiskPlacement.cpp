@@ -0,0 +1,124 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameModes/AccelByteWarsDiskPlacement.h"
+
+void FAccelByteWarsDiskPlacement::Init(
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound,
+	const float MaxRadius,
+	const float InGap)
+{
+	Min = MinBound;
+	Max = MaxBound;
+	Gap = FMath::Max(InGap, 0.0f);
+
+	// a disk of the max size covers at most 2x2 cells
+	CellSize = FMath::Max(2.0f * MaxRadius + Gap, 1.0f);
+	NumCellsX = FMath::Max(1, FMath::CeilToInt((Max.X - Min.X) / CellSize));
+	NumCellsY = FMath::Max(1, FMath::CeilToInt((Max.Y - Min.Y) / CellSize));
+
+	Cells.Reset();
+	Cells.SetNum(NumCellsX * NumCellsY);
+	Disks.Reset();
+	Anchors.Reset();
+}
+
+void FAccelByteWarsDiskPlacement::AddObstacle(const FVector2D& Center, const float Radius)
+{
+	AddDisk(Center, Radius, false);
+}
+
+bool FAccelByteWarsDiskPlacement::PlaceDisk(const float Radius, FRandomStream& Random, FVector2D& OutCenter)
+{
+	// uniform darts first, so that a sparse area looks like a plain random placement
+	for (int32 i = 0; i < NumDarts; ++i)
+	{
+		const FVector2D Candidate(
+			FMath::Lerp(Min.X, Max.X, Random.GetFraction()),
+			FMath::Lerp(Min.Y, Max.Y, Random.GetFraction()));
+		if (IsFree(Candidate, Radius))
+		{
+			OutCenter = Candidate;
+			AddDisk(Candidate, Radius, true);
+			return true;
+		}
+	}
+
+	// pack next to placed disks, at one to two times the touching distance
+	for (int32 i = 0; i < NumAnnulusCandidates && !Anchors.IsEmpty(); ++i)
+	{
+		const FVector& Anchor = Disks[Anchors[Random.RandHelper(Anchors.Num())]];
+		const float TouchingDistance = Anchor.Z + Radius + Gap;
+		const float Distance = TouchingDistance * (1.0f + Random.GetFraction());
+		const float Angle = Random.GetFraction() * 2.0f * PI;
+
+		const FVector2D Candidate(
+			Anchor.X + Distance * FMath::Cos(Angle),
+			Anchor.Y + Distance * FMath::Sin(Angle));
+		if (IsInBound(Candidate) && IsFree(Candidate, Radius))
+		{
+			OutCenter = Candidate;
+			AddDisk(Candidate, Radius, true);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FAccelByteWarsDiskPlacement::IsInBound(const FVector2D& Center) const
+{
+	return Center.X >= Min.X && Center.X <= Max.X && Center.Y >= Min.Y && Center.Y <= Max.Y;
+}
+
+bool FAccelByteWarsDiskPlacement::IsFree(const FVector2D& Center, const float Radius) const
+{
+	// a disk closer than the gap overlaps the query box in at least one cell
+	const FIntRect Range = GetCellRange(Center, Radius + Gap);
+	for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+	{
+		for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+		{
+			for (const int32 DiskIndex : Cells[Y * NumCellsX + X])
+			{
+				const FVector& Disk = Disks[DiskIndex];
+				const float MinDistance = Disk.Z + Radius + Gap;
+				if (FVector2D::DistSquared(Center, FVector2D(Disk.X, Disk.Y)) < FMath::Square(MinDistance))
+				{
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+void FAccelByteWarsDiskPlacement::AddDisk(const FVector2D& Center, const float Radius, const bool bCanAnchor)
+{
+	const int32 DiskIndex = Disks.Add(FVector(Center.X, Center.Y, Radius));
+	if (bCanAnchor)
+	{
+		Anchors.Add(DiskIndex);
+	}
+
+	const FIntRect Range = GetCellRange(Center, Radius);
+	for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+	{
+		for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+		{
+			Cells[Y * NumCellsX + X].Add(DiskIndex);
+		}
+	}
+}
+
+FIntRect FAccelByteWarsDiskPlacement::GetCellRange(const FVector2D& Center, const double Extent) const
+{
+	// clamping keeps disks and queries outside of the bound in the border cells, overlap is preserved
+	return FIntRect(
+		FMath::Clamp(FMath::FloorToInt((Center.X - Extent - Min.X) / CellSize), 0, NumCellsX - 1),
+		FMath::Clamp(FMath::FloorToInt((Center.Y - Extent - Min.Y) / CellSize), 0, NumCellsY - 1),
+		FMath::Clamp(FMath::FloorToInt((Center.X + Extent - Min.X) / CellSize), 0, NumCellsX - 1),
+		FMath::Clamp(FMath::FloorToInt((Center.Y + Extent - Min.Y) / CellSize), 0, NumCellsY - 1));
+}
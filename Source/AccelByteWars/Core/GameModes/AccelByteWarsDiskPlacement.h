@@ -0,0 +1,73 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Places non-overlapping disks (e.g. planets) with their centers inside a rectangle, in bounded time.
+ * Variable radius Poisson-disk sampling: a few uniform darts per disk keep the placement spread over the area, when
+ * they all hit something, candidates are drawn in the annulus around random already placed disks (Bridson).
+ * A disk costs at most NumDarts + NumAnnulusCandidates overlap checks, each one a lookup in a uniform grid.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsDiskPlacement
+{
+public:
+	/**
+	 * @param MinBound Min bound of the disk centers
+	 * @param MaxBound Max bound of the disk centers
+	 * @param MaxRadius Largest disk that will be placed, sizes the grid cells
+	 * @param InGap Min distance between the edges of two disks
+	 */
+	void Init(const FVector2D& MinBound, const FVector2D& MaxBound, const float MaxRadius, const float InGap);
+
+	/**
+	 * @brief Add an existing object that placed disks keep away from. It may be outside of the bound.
+	 */
+	void AddObstacle(const FVector2D& Center, const float Radius);
+
+	/**
+	 * @brief Find room for a disk and reserve it
+	 * @param Radius Disk radius
+	 * @param Random Random source, the result is deterministic for a given stream state
+	 * @param OutCenter Output: disk center
+	 * @return false if no room was found within the candidate budget
+	 */
+	bool PlaceDisk(const float Radius, FRandomStream& Random, FVector2D& OutCenter);
+
+	int32 GetNumDisks() const { return Disks.Num(); }
+
+	/**
+	 * @brief Uniformly distributed candidates tried first
+	 */
+	int32 NumDarts = 8;
+
+	/**
+	 * @brief Candidates tried around placed disks once the darts missed
+	 */
+	int32 NumAnnulusCandidates = 32;
+
+private:
+	bool IsInBound(const FVector2D& Center) const;
+	bool IsFree(const FVector2D& Center, const float Radius) const;
+	void AddDisk(const FVector2D& Center, const float Radius, const bool bCanAnchor);
+	FIntRect GetCellRange(const FVector2D& Center, const double Extent) const;
+
+	FVector2D Min = FVector2D::ZeroVector;
+	FVector2D Max = FVector2D::ZeroVector;
+	float Gap = 0.0f;
+	float CellSize = 1.0f;
+	int32 NumCellsX = 0;
+	int32 NumCellsY = 0;
+
+	// X, Y center, Z radius
+	TArray<FVector> Disks;
+
+	// Disks overlapping each cell
+	TArray<TArray<int32, TInlineAllocator<4>>> Cells;
+
+	// Placed disks, new candidates are drawn around them
+	TArray<int32> Anchors;
+};
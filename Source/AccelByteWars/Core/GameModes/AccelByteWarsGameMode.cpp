@@ -147,6 +147,9 @@ void AAccelByteWarsGameMode::PlayerTeamSetup(APlayerController* PlayerController
 		{
 			PlayerData->UniqueNetId = PlayerUniqueId;
 
+			// the player is found by the new id from now on, in the index and in the replicated slots
+			ABGameState->MarkTeamsDirty();
+
 			// notify local
 			ABGameState->OnNotify_Teams();
 		}
@@ -88,6 +88,7 @@ protected:
 	// Countdown functionalities to simulate server crash.
 	void SetupSimulateServerCrashCountdownValue(const FString& SimulateServerCrashArg);
 	void SimulateServerCrashCountdownCounting(const float& DeltaSeconds) const;
+	bool ShouldSimulateServerCrash() const { return bShouldSimulateServerCrash; }
 
 	UPROPERTY()
 	UAccelByteWarsGameInstance* GameInstance = nullptr;
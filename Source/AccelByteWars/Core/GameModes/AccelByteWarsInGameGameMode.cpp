@@ -6,20 +6,26 @@
 
 #include "Core/Player/AccelByteWarsPlayerPawn.h"
 #include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
+#include "Core/GameModes/AccelByteWarsDiskPlacement.h"
 #include "Core/Player/AccelByteWarsPlayerState.h"
+#include "Core/System/AccelByteWarsActorPoolSubsystem.h"
+#include "Core/System/AccelByteWarsClassRegistrySubsystem.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
 #include "Core/System/AccelByteWarsGameSession.h"
 #include "Core/UI/Components/Prompt/PromptSubsystem.h"
 #include "Core/Utilities/AccelByteWarsUtility.h"
+#include "Engine/NetDriver.h"
 #include "GameFramework/PlayerStart.h"
 #include "Kismet/GameplayStatics.h"
-#include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 
 #define NULLPTR_CHECK(Object) if (!Object) return;
 
 AAccelByteWarsInGameGameMode::AAccelByteWarsInGameGameMode()
 {
-	PrimaryActorTick.bStartWithTickEnabled = true;
+	// The game status is driven by events and timers, Tick is only enabled to simulate a server crash
+	// or for a Blueprint subclass implementing Event Tick, see BeginPlay
+	PrimaryActorTick.bStartWithTickEnabled = false;
 	PrimaryActorTick.bCanEverTick = true;
 	PrimaryActorTick.TickInterval = 0.05f;
 	bAllowTickBeforeBeginPlay = false;
@@ -42,7 +48,24 @@ void AAccelByteWarsInGameGameMode::BeginPlay()
 {
 	// Setup game data
 	ABInGameGameState->GameStatus = EGameStatus::AWAITING_PLAYERS;
-	ABInGameGameState->TimeLeft = ABInGameGameState->GameSetup.MatchTime;
+
+	// Countdowns start from the game setup, the dedicated server shutdown ones are set up below
+	ABInGameGameState->PreGameCountdownTimer.Set(ABInGameGameState->PreGameCountdown);
+	ABInGameGameState->TimeLeftTimer.Set(ABInGameGameState->GameSetup.MatchTime);
+	ABInGameGameState->PostGameCountdownTimer.Set(ABInGameGameState->PostGameCountdown);
+	ABInGameGameState->NotEnoughPlayerCountdownTimer.Set(ABInGameGameState->NotEnoughPlayerCountdown);
+
+	// Resolve every blueprint class spawned during the match while waiting for players
+	PreloadGameplayClasses();
+
+	// Reproducible planet placement for perf runs
+	int32 RandomSeed = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-MatchRandomSeed="), RandomSeed))
+	{
+		GAMEMODE_LOG(Log, TEXT("Using random seed %d"), RandomSeed);
+		FMath::RandInit(RandomSeed);
+		FMath::SRandInit(RandomSeed);
+	}
 
 #pragma region "Server Shutdown Implementation"
 #if UE_SERVER || UE_EDITOR
@@ -53,110 +76,72 @@ void AAccelByteWarsInGameGameMode::BeginPlay()
 		/* Set simulate server crash countdown.
 		 * The countdown will only be started in the gameplay level.*/
 		SetupSimulateServerCrashCountdownValue(FString("-SIM_SERVER_CRASH_GAMEPLAY"));
+		SetActorTickEnabled(ShouldSimulateServerCrash());
 	}
 #endif
 #pragma endregion
+
+	// Tick starts disabled, which also silences Event Tick. B_InGameGameMode has none, a Blueprint subclass that adds one still ticks
+	if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AAccelByteWarsInGameGameMode, ReceiveTick)))
+	{
+		GAMEMODE_LOG(Log, TEXT("%s implements Event Tick, ticking every %.2f s"), *GetClass()->GetName(), PrimaryActorTick.TickInterval);
+		SetActorTickEnabled(true);
+	}
+
+	// registered players and their teams affect the game status
+	ABInGameGameState->OnTeamsChanged.AddUniqueDynamic(this, &ThisClass::OnGameStateTeamsChanged);
+
+	// keep the spawn location free space up to date
+	ABInGameGameState->OnActiveGameObjectAdded.AddUniqueDynamic(this, &ThisClass::OnGameObjectAdded);
+	ABInGameGameState->OnActiveGameObjectRemoved.AddUniqueDynamic(this, &ThisClass::OnGameObjectRemoved);
+
+	// pooled gameplay objects are not destroyed, they leave play when released
+	if (UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>())
+	{
+		ActorPool->OnActorReleased.AddUObject(this, &ThisClass::RemoveFromActiveGameObjects);
+	}
+	RequestGameStatusUpdate();
 	
 	Super::BeginPlay();
 }
 
 void AAccelByteWarsInGameGameMode::Tick(float DeltaSeconds)
 {
+	ACCELBYTEWARS_FRAME_SCOPE(GameModeTick);
+
 	Super::Tick(DeltaSeconds);
 
 	switch (ABInGameGameState->GameStatus)
 	{
-	case EGameStatus::IDLE:
-	case EGameStatus::AWAITING_PLAYERS:
-		// check if all registered players have re-enter the server
-		if (ABInGameGameState->PlayerArray.Num() == ABInGameGameState->GetRegisteredPlayersNum())
-		{
-			ABInGameGameState->GameStatus = EGameStatus::PRE_GAME_COUNTDOWN_STARTED;
-			if (IsRunningDedicatedServer())
-			{
-				// reset NotEnoughPlayerCountdown
-				SetupShutdownCountdownsValue();
-			}
-		}
-		else
-		{
-			// use NotEnoughPlayerCountdown as a countdown to wait all registered player to reconnect to the DS
-			if (IsRunningDedicatedServer())
-			{
-				NotEnoughPlayerCountdownCounting(DeltaSeconds);
-			}
-		}
-		break;
-	case EGameStatus::PRE_GAME_COUNTDOWN_STARTED:
-		ABInGameGameState->PreGameCountdown -= DeltaSeconds;
-		if (ABInGameGameState->PreGameCountdown <= 0)
-		{
-			ABInGameGameState->GameStatus = EGameStatus::GAME_STARTED;
-			StartGame();
-		}
-		break;
 	case EGameStatus::AWAITING_PLAYERS_MID_GAME:
-		if (IsRunningDedicatedServer())
-		{
-			SimulateServerCrashCountdownCounting(DeltaSeconds);
-
-			if (ShouldStartNotEnoughPlayerCountdown())
-			{
-				NotEnoughPlayerCountdownCounting(DeltaSeconds);
-			}
-			else
-			{
-				ABInGameGameState->GameStatus = EGameStatus::GAME_STARTED;
-				SetupShutdownCountdownsValue();
-			}
-		}
-		break;
 	case EGameStatus::GAME_STARTED:
-		if (IsRunningDedicatedServer())
-		{
-			SimulateServerCrashCountdownCounting(DeltaSeconds);
-
-			if (ShouldStartNotEnoughPlayerCountdown())
-			{
-				ABInGameGameState->GameStatus = EGameStatus::AWAITING_PLAYERS_MID_GAME;
-			}
-		}
-
-		// Gameplay timer
-		ABInGameGameState->TimeLeft -= DeltaSeconds;
-		if (ABInGameGameState->TimeLeft <= 0)
-		{
-			ABInGameGameState->TimeLeft = 0;
-			EndGame("Time is over");
-		}
-		break;
-	case EGameStatus::GAME_ENDS_DELAY:
-		GameEndsDelay -= DeltaSeconds;
-		if (GameEndsDelay <= 0)
-		{
-			ABInGameGameState->GameStatus = EGameStatus::GAME_ENDS;
-		}
-		break;
-	case EGameStatus::GAME_ENDS:
-		if (IsRunningDedicatedServer() && ABInGameGameState->GameSetup.GameEndsShutdownCountdown != INDEX_NONE)
-		{
-			ABInGameGameState->PostGameCountdown -= DeltaSeconds;
-			if (ABInGameGameState->PostGameCountdown <= 0)
-			{
-				CloseGame("Game finished");
-			}
-		}
-		break;
-	case EGameStatus::INVALID:
+		SimulateServerCrashCountdownCounting(DeltaSeconds);
 		break;
 	default: ;
 	}
 }
 
+void AAccelByteWarsInGameGameMode::PreLogin(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage)
+{
+	Super::PreLogin(Options, Address, UniqueId, ErrorMessage);
+
+	// a client joining the results screen is served at the full tick rate too
+	if (ErrorMessage.IsEmpty() && ABInGameGameState->GameStatus == EGameStatus::GAME_ENDS)
+	{
+		bClientJoinedAfterGameEnded = true;
+	}
+
+	// the client connection exists by now, run at the full tick rate for the rest of the login
+	UpdateServerTickRate();
+}
+
 void AAccelByteWarsInGameGameMode::PostLogin(APlayerController* NewPlayer)
 {
 	Super::PostLogin(NewPlayer);
 
+	// a new PlayerState in PlayerArray
+	bLivingTeamsDirty = true;
+
 	APlayerState* PlayerState = NewPlayer->PlayerState;
 	if (!PlayerState)
 	{
@@ -174,6 +159,23 @@ void AAccelByteWarsInGameGameMode::PostLogin(APlayerController* NewPlayer)
 	{
 		SpawnAndPossesPawn(PlayerState);
 	}
+
+	RequestGameStatusUpdate();
+}
+
+void AAccelByteWarsInGameGameMode::Logout(AController* Exiting)
+{
+	Super::Logout(Exiting);
+
+	// the PlayerState leaves PlayerArray after Logout, count it out now so that a rebuild does not count it back in
+	if (Exiting)
+	{
+		GetLivingTeamCount();
+		LivingTeams.RemovePlayer(Exiting->PlayerState);
+	}
+
+	// the update runs on the next tick
+	RequestGameStatusUpdate();
 }
 
 void AAccelByteWarsInGameGameMode::DelayedPlayerTeamSetupWithPredefinedData(APlayerController* PlayerController)
@@ -200,6 +202,8 @@ void AAccelByteWarsInGameGameMode::DelayedPlayerTeamSetupWithPredefinedData(APla
 	{
 		SpawnAndPossesPawn(PlayerState);
 	}
+
+	RequestGameStatusUpdate();
 }
 
 int32 AAccelByteWarsInGameGameMode::AddPlayerScore(
@@ -225,13 +229,13 @@ int32 AAccelByteWarsInGameGameMode::AddPlayerScore(
 	// set score in PlayerState and GameState
 	const float FinalScore = AccelByteWarsPlayerState->GetScore() + InScore;
 	AccelByteWarsPlayerState->SetScore(FinalScore);
-	PlayerData->Score = FinalScore;
+	ABInGameGameState->SetPlayerScore(*PlayerData, FinalScore);
 
 	// increase kill count
 	if (bAddKillCount)
 	{
 		AccelByteWarsPlayerState->KillCount++;
-		PlayerData->KillCount = AccelByteWarsPlayerState->KillCount;
+		ABInGameGameState->SetPlayerKillCount(*PlayerData, AccelByteWarsPlayerState->KillCount);
 	}
 
 	return AccelByteWarsPlayerState->GetScore();
@@ -259,8 +263,12 @@ int32 AAccelByteWarsInGameGameMode::DecreasePlayerLife(APlayerState* PlayerState
 	AccelByteWarsPlayerState->NumKilledAttemptInSingleLifetime = 0;
 
 	// match life num in GameState to PlayerState
-	PlayerData->NumLivesLeft = AccelByteWarsPlayerState->NumLivesLeft;
 	PlayerData->NumKilledAttemptInSingleLifetime = AccelByteWarsPlayerState->NumKilledAttemptInSingleLifetime;
+	ABInGameGameState->SetPlayerLivesLeft(*PlayerData, AccelByteWarsPlayerState->NumLivesLeft);
+	UpdateLivingPlayer(AccelByteWarsPlayerState);
+
+	// living team count may have changed
+	RequestGameStatusUpdate();
 
 	return AccelByteWarsPlayerState->NumLivesLeft;
 }
@@ -269,6 +277,16 @@ void AAccelByteWarsInGameGameMode::EndGame(const FString Reason)
 {
 	ABInGameGameState->GameStatus = EGameStatus::GAME_ENDS_DELAY;
 
+	if (!GetWorldTimerManager().IsTimerActive(GameEndsDelayTimerHandle))
+	{
+		GetWorldTimerManager().SetTimer(GameEndsDelayTimerHandle, FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			ABInGameGameState->GameStatus = EGameStatus::GAME_ENDS;
+			RequestGameStatusUpdate();
+		}), GameEndsDelay, false);
+	}
+	RequestGameStatusUpdate();
+
 	OnGameEndsDelegate.Broadcast();
 
 	GAMEMODE_LOG(Log, TEXT("Game ends with reason: %s."), *Reason);
@@ -343,14 +361,9 @@ void AAccelByteWarsInGameGameMode::OnShipDestroyed(
 	}
 
 	// If score limit reached, end game
-	FGameplayTeamData TeamData;
-	float TeamScore;
-	int32 TeamLivesLeft;
-	int32 TeamKillCount;
-	ABInGameGameState->GetTeamDataByTeamId(SourcePlayerState->TeamId, TeamData, TeamScore, TeamLivesLeft, TeamKillCount);
 	if (ABInGameGameState->GameSetup.ScoreLimit >= 0)
 	{
-		if (TeamScore >= ABInGameGameState->GameSetup.ScoreLimit)
+		if (ABInGameGameState->GetTeamScore(SourcePlayerState->TeamId) >= ABInGameGameState->GameSetup.ScoreLimit)
 		{
 			EndGame("Score limit reached");
 			return;
@@ -370,6 +383,7 @@ void AAccelByteWarsInGameGameMode::IncreasePlayerKilledAttempt(const APlayerCont
 
 	TargetPlayerState->NumKilledAttemptInSingleLifetime++;
 	PlayerData->NumKilledAttemptInSingleLifetime = TargetPlayerState->NumKilledAttemptInSingleLifetime;
+	ABInGameGameState->MarkPlayerDataDirty(*PlayerData);
 }
 
 void AAccelByteWarsInGameGameMode::OnRefreshPlayerSelectedPowerUp(const APlayerController* TargetPlayer, const EPowerUpSelection SelectedPowerUp, const int32 PowerUpCount)
@@ -387,6 +401,7 @@ void AAccelByteWarsInGameGameMode::OnRefreshPlayerSelectedPowerUp(const APlayerC
 
 	PlayerData->SelectedPowerUp = TargetPlayerState->SelectedPowerUp;
 	PlayerData->PowerUpCount = TargetPlayerState->PowerUpCount;
+	ABInGameGameState->MarkPlayerDataDirty(*PlayerData);
 }
 
 void AAccelByteWarsInGameGameMode::RemoveFromActiveGameObjects(AActor* DestroyedActor)
@@ -394,8 +409,28 @@ void AAccelByteWarsInGameGameMode::RemoveFromActiveGameObjects(AActor* Destroyed
 	if (UAccelByteWarsGameplayObjectComponent* Component =
 		DestroyedActor->FindComponentByClass<UAccelByteWarsGameplayObjectComponent>())
 	{
-		ABInGameGameState->ActiveGameObjects.Remove(Component);
+		ABInGameGameState->RemoveActiveGameObject(Component);
+	}
+}
+
+void AAccelByteWarsInGameGameMode::OnGameObjectAdded(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	// ships move, they are checked at query time
+	if (bSpawnLocationGridDirty || !Component || !Component->GetOwner() || !FAccelByteWarsGravityField::IsStaticBody(Component))
+	{
+		return;
 	}
+
+	const FVector& ActorLocation = Component->GetOwner()->GetActorLocation();
+	SpawnLocationGrid.AddBlocker(
+		Component,
+		FVector2D(ActorLocation.X, ActorLocation.Y),
+		(Component->Radius * 100.0f) + ObjectSafeDistance);
+}
+
+void AAccelByteWarsInGameGameMode::OnGameObjectRemoved(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	SpawnLocationGrid.RemoveBlocker(Component);
 }
 
 #pragma region "Gameplay logic"
@@ -419,6 +454,15 @@ void AAccelByteWarsInGameGameMode::CloseGame(const FString& Reason) const
 
 void AAccelByteWarsInGameGameMode::StartGame()
 {
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (GameplayClassesWaitStartTime >= 0.0)
+	{
+		GAMEMODE_LOG(Log, TEXT("Game started %.2f ms after the pre-game countdown, waiting for gameplay class preloads"),
+			(FPlatformTime::Seconds() - GameplayClassesWaitStartTime) * 1000.0);
+		GameplayClassesWaitStartTime = -1.0;
+	}
+
 	// Spawn player start
 	for (const FVector& PlayerStart : PlayerStartPoints)
 	{
@@ -433,6 +477,69 @@ void AAccelByteWarsInGameGameMode::StartGame()
 
 	// Spawn planets
 	SpawnPlanets();
+
+	// Pre-warm the missile and trail pools so that firing doesn't spawn actors mid match
+	UAccelByteWarsActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+	UAccelByteWarsClassRegistrySubsystem* ClassRegistry = GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	const UClass* PawnClass = ClassRegistry != nullptr ? ClassRegistry->FindOrLoadClass(PawnBlueprintPath) : nullptr;
+	if (ActorPool != nullptr && PawnClass != nullptr)
+	{
+		if (const AAccelByteWarsPlayerPawn* PawnDefault = Cast<AAccelByteWarsPlayerPawn>(PawnClass->GetDefaultObject()))
+		{
+			const int32 PrewarmCount = ABInGameGameState->GameSetup.FiredMissilesLimit * ABInGameGameState->GameSetup.MaxPlayers;
+
+			UClass* MissileClass = ClassRegistry->FindOrLoadClass(PawnDefault->FiredMissileBlueprintPath);
+			ActorPool->PrewarmActors(MissileClass, PrewarmCount);
+
+			UClass* MissileTrailClass = ClassRegistry->FindOrLoadClass(PawnDefault->FiredMissileTrailBlueprintPath);
+			ActorPool->PrewarmActors(MissileTrailClass, PrewarmCount);
+		}
+	}
+
+	// the first spawns of the match, cache misses here mean a class was loaded on the game thread
+	GAMEMODE_LOG(Log, TEXT("Game start spawns took %.2f ms, %d class cache misses so far"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0,
+		ClassRegistry != nullptr ? ClassRegistry->GetNumCacheMisses() : 0);
+}
+
+void AAccelByteWarsInGameGameMode::PreloadGameplayClasses()
+{
+	UAccelByteWarsClassRegistrySubsystem* ClassRegistry = GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	if (ClassRegistry == nullptr)
+	{
+		return;
+	}
+
+	// a pre-game countdown that ran out before the preloads waits for them
+	ClassRegistry->OnAsyncPreloadsCompleted.AddUObject(this, &ThisClass::RequestGameStatusUpdate);
+
+	// The pawn spawns its missile, trail, ship and power up by path, read them once it is loaded
+	ClassRegistry->PreloadClassesAsync({PawnBlueprintPath}, FSimpleDelegate::CreateWeakLambda(this, [this, ClassRegistry]()
+	{
+		const UClass* PawnClass = ClassRegistry->FindOrLoadClass(PawnBlueprintPath);
+		if (PawnClass == nullptr)
+		{
+			GAMEMODE_LOG(Warning, TEXT("Failed to load pawn class: %s"), *PawnBlueprintPath);
+			return;
+		}
+
+		// ship designs are picked by the clients when their pawn spawns, resolve all of them
+		if (const AAccelByteWarsPlayerPawn* PawnDefault = Cast<AAccelByteWarsPlayerPawn>(PawnClass->GetDefaultObject()))
+		{
+			TArray<FString> BlueprintPaths;
+			BlueprintPaths.Add(PawnDefault->FiredMissileBlueprintPath);
+			BlueprintPaths.Add(PawnDefault->FiredMissileTrailBlueprintPath);
+			BlueprintPaths.Append(PawnDefault->PlayerShipBlueprintPaths);
+			BlueprintPaths.Append(PawnDefault->PlayerPowerUpBlueprintPaths);
+			ClassRegistry->PreloadClassesAsync(BlueprintPaths);
+		}
+	}));
+}
+
+bool AAccelByteWarsInGameGameMode::IsPreloadingGameplayClasses() const
+{
+	const UAccelByteWarsClassRegistrySubsystem* ClassRegistry = GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	return ClassRegistry != nullptr && ClassRegistry->IsAsyncPreloading();
 }
 
 void AAccelByteWarsInGameGameMode::SetupGameplayObject(AActor* Object) const
@@ -441,7 +548,7 @@ void AAccelByteWarsInGameGameMode::SetupGameplayObject(AActor* Object) const
 	if (UAccelByteWarsGameplayObjectComponent* Component =
 		Cast<UAccelByteWarsGameplayObjectComponent>(Object->GetComponentByClass(UAccelByteWarsGameplayObjectComponent::StaticClass())))
 	{
-		ABInGameGameState->ActiveGameObjects.Add(Component);
+		ABInGameGameState->AddActiveGameObject(Component);
 	}
 
 	Object->OnDestroyed.AddDynamic(this, &ThisClass::RemoveFromActiveGameObjects);
@@ -449,31 +556,36 @@ void AAccelByteWarsInGameGameMode::SetupGameplayObject(AActor* Object) const
 
 int32 AAccelByteWarsInGameGameMode::GetLivingTeamCount() const
 {
-	// check currently connected player TeamId
-	TArray<int32> ActiveTeams;
-
-	// check if all player in the same team or if there's no player at all
-	for (const TObjectPtr<APlayerState> Player : ABInGameGameState->PlayerArray)
+	if (bLivingTeamsDirty)
 	{
-		if (const AAccelByteWarsPlayerState* ByteWarsPlayerState =
-			static_cast<const AAccelByteWarsPlayerState*>(Player))
+		LivingTeams.Reset();
+		for (const TObjectPtr<APlayerState> Player : ABInGameGameState->PlayerArray)
 		{
-			// if player's have no lives left, skip
-			if (ByteWarsPlayerState->NumLivesLeft <= 0)
+			if (const AAccelByteWarsPlayerState* ByteWarsPlayerState = Cast<AAccelByteWarsPlayerState>(Player))
 			{
-				continue;
+				LivingTeams.SetPlayer(ByteWarsPlayerState, ByteWarsPlayerState->TeamId, ByteWarsPlayerState->NumLivesLeft);
 			}
-
-			// set TeamId to the first 'living' player
-			ActiveTeams.AddUnique(ByteWarsPlayerState->TeamId);
 		}
+		bLivingTeamsDirty = false;
 	}
 
-	return ActiveTeams.Num();
+	return LivingTeams.Num();
+}
+
+void AAccelByteWarsInGameGameMode::UpdateLivingPlayer(const APlayerState* PlayerState)
+{
+	// a dirty count picks the change up on rebuild
+	const AAccelByteWarsPlayerState* ByteWarsPlayerState = Cast<AAccelByteWarsPlayerState>(PlayerState);
+	if (!bLivingTeamsDirty && ByteWarsPlayerState)
+	{
+		LivingTeams.SetPlayer(ByteWarsPlayerState, ByteWarsPlayerState->TeamId, ByteWarsPlayerState->NumLivesLeft);
+	}
 }
 
 void AAccelByteWarsInGameGameMode::SpawnAndPossesPawn(APlayerState* PlayerState)
 {
+	ACCELBYTEWARS_FRAME_SCOPE(Spawning);
+
 	AAccelByteWarsPlayerState* ABPlayerState = Cast<AAccelByteWarsPlayerState>(PlayerState);
 	NULLPTR_CHECK(ABPlayerState)
 
@@ -506,7 +618,11 @@ APawn* AAccelByteWarsInGameGameMode::CreatePlayerPawn(const FVector& Location, A
 	spawn_parameters.Owner = PlayerController;
 	spawn_parameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	UClass* generic_class = StaticLoadClass(AActor::StaticClass(), this, *PawnBlueprintPath);
+	UAccelByteWarsClassRegistrySubsystem* class_registry = GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	if (class_registry == nullptr)
+		return nullptr;
+
+	UClass* generic_class = class_registry->FindOrLoadClass(PawnBlueprintPath);
 
 	AAccelByteWarsPlayerPawn* NewPlayerPawn = PlayerController->GetWorld()->SpawnActor<AAccelByteWarsPlayerPawn>(generic_class, FTransform(FRotator::ZeroRotator, Location), spawn_parameters);
 	if (NewPlayerPawn == nullptr)
@@ -534,31 +650,10 @@ APawn* AAccelByteWarsInGameGameMode::CreatePlayerPawn(const FVector& Location, A
 	return NewPlayerPawn;
 }
 
-TArray<FVector> AAccelByteWarsInGameGameMode::GetActiveGameObjectsPosition() const
-{
-	TArray<FVector> Positions;
-
-	for (const UAccelByteWarsGameplayObjectComponent* ActiveGameObject : ABInGameGameState->ActiveGameObjects)
-	{
-		// failsafe
-		if (!ActiveGameObject)
-		{
-			continue;
-		}
-
-		const FVector& ActorLocation = ActiveGameObject->GetOwner()->GetActorLocation();
-		const float Z = (ActiveGameObject->Radius * 100.0) + ObjectSafeDistance;
-		Positions.Add(FVector(ActorLocation.X, ActorLocation.Y, Z));
-	}
-
-	return Positions;
-}
-
 bool AAccelByteWarsInGameGameMode::FindGoodSpawnLocation(FVector2D& OutCoord)
 {
 	if (!FindGoodSpawnLocation(
 		OutCoord,
-		GetActiveGameObjectsPosition(),
 		ABInGameGameState->MinGameBound,
 		ABInGameGameState->MaxGameBound))
 	{
@@ -569,6 +664,18 @@ bool AAccelByteWarsInGameGameMode::FindGoodSpawnLocation(FVector2D& OutCoord)
 
 void AAccelByteWarsInGameGameMode::SpawnPlanets()
 {
+	ACCELBYTEWARS_FRAME_SCOPE(Spawning);
+
+	FVector2D MinBound;
+	FVector2D MaxBound;
+	GetPlanetSpawnArea(MinBound, MaxBound);
+
+	FAccelByteWarsDiskPlacement Placement;
+	SetupPlanetPlacement(Placement, MinBound, MaxBound);
+
+	// follows FMath's seed, see -MatchRandomSeed
+	FRandomStream Random(FMath::Rand());
+
 	for (int i = 0; i < MaxTargetPlanetCount; ++i)
 	{
 		// random which planet to spawn
@@ -576,11 +683,13 @@ void AAccelByteWarsInGameGameMode::SpawnPlanets()
 		const FPlanetMetadata PlanetData = *PlanetMap.Find(RandomIndex);
 
 		// Calculate pseudorandom location
-		FVector Location;
-		if (!FindGoodPlanetPosition(Location))
+		FVector2D Position2D;
+		if (!Placement.PlaceDisk(PlanetData.PlanetRadius, Random, Position2D))
 		{
+			GAMEMODE_LOG(Warning, TEXT("Not enough room, skipping spawn."));
 			continue;
 		}
+		const FVector Location(Position2D.X, Position2D.Y, 0.0f);
 
 		const TSubclassOf<AActor>& ObjectToSpawn = ObjectsToSpawn[PlanetData.PlanetID];
 		AActor* SpawnedObject = GetWorld()->SpawnActor(ObjectToSpawn, &Location, &FRotator::ZeroRotator);
@@ -588,11 +697,8 @@ void AAccelByteWarsInGameGameMode::SpawnPlanets()
 	}
 }
 
-bool AAccelByteWarsInGameGameMode::FindGoodPlanetPosition(FVector& Position) const
+void AAccelByteWarsInGameGameMode::GetPlanetSpawnArea(FVector2D& MinBound, FVector2D& MaxBound) const
 {
-	FVector2D MaxBound;
-	FVector2D MinBound;
-
 	// calculate allowable spawn area width and height
 	const float PlanetSpawnProhibitedAreaDecimal = 1 - (PlanetSpawnAreaPercentage / 100.0f);
 	const float ProhibitedWidth =
@@ -625,25 +731,32 @@ bool AAccelByteWarsInGameGameMode::FindGoodPlanetPosition(FVector& Position) con
 			0,
 			10.0f);
 	}
+}
 
-	const TArray<FVector> ActiveGameObjectsCoords = GetActiveGameObjectsPosition();
-	FVector2D Position2D;
-	if (!FindGoodSpawnLocation(
-		Position2D,
-		ActiveGameObjectsCoords,
-		MinBound,
-		MaxBound))
+void AAccelByteWarsInGameGameMode::SetupPlanetPlacement(
+	FAccelByteWarsDiskPlacement& Placement,
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound) const
+{
+	float MaxPlanetRadius = 0.0f;
+	for (const TPair<int32, FPlanetMetadata>& Planet : PlanetMap)
 	{
-		return false;
+		MaxPlanetRadius = FMath::Max(MaxPlanetRadius, Planet.Value.PlanetRadius);
 	}
+	Placement.Init(MinBound, MaxBound, MaxPlanetRadius, ObjectSafeDistance);
 
-	Position.X = Position2D.X;
-	Position.Y = Position2D.Y;
-	
-	return true;
+	// planets keep ObjectSafeDistance away from everything already in play
+	for (const FVector& Position : ABInGameGameState->GetStaticBodyPositions())
+	{
+		Placement.AddObstacle(FVector2D(Position.X, Position.Y), Position.Z);
+	}
+	for (const FVector& Position : ABInGameGameState->GetShipPositions())
+	{
+		Placement.AddObstacle(FVector2D(Position.X, Position.Y), Position.Z);
+	}
 }
 
-FVector AAccelByteWarsInGameGameMode::FindGoodPlayerPosition(APlayerState* PlayerState) const
+FVector AAccelByteWarsInGameGameMode::FindGoodPlayerPosition(APlayerState* PlayerState)
 {
 	FVector Position = FVector::ZeroVector;
 	FVector2D MaxBound;
@@ -692,12 +805,32 @@ FVector AAccelByteWarsInGameGameMode::FindGoodPlayerPosition(APlayerState* Playe
 	default: ;
 	}
 
-	// pseudo-randomizer
-	const TArray<FVector> ActiveGameObjectsCoords = GetActiveGameObjectsPosition();
+	// pseudo-randomizer, falls back to the least crowded spot of the quadrant.
+	// A few candidates are tried for one hidden from the other ships by planets, the first free one is used otherwise
 	FVector2D Position2;
-	if (!FindGoodSpawnLocation(Position2, ActiveGameObjectsCoords, MinBound, MaxBound))
+	for (int32 Candidate = 0; Candidate < FMath::Max(HiddenSpawnCandidates, 1); ++Candidate)
 	{
-		GAMEMODE_LOG(Warning, TEXT("Can't find good spawn location for PLAYER. Please report"));
+		FVector2D CandidatePosition;
+		if (!FindGoodSpawnLocation(CandidatePosition, MinBound, MaxBound))
+		{
+			// the fallback is the same spot every time, no other candidate will come up
+			if (Candidate == 0)
+			{
+				Position2 = CandidatePosition;
+				GAMEMODE_LOG(Warning, TEXT("Can't find good spawn location for PLAYER. Please report"));
+			}
+			break;
+		}
+
+		const bool bHidden = !LocationHasLineOfSightToOtherShip(FVector(CandidatePosition, 0.0f));
+		if (Candidate == 0 || bHidden)
+		{
+			Position2 = CandidatePosition;
+		}
+		if (bHidden)
+		{
+			break;
+		}
 	}
 	Position.X = Position2.X;
 	Position.Y = Position2.Y;
@@ -726,6 +859,179 @@ FVector AAccelByteWarsInGameGameMode::FindGoodPlayerPosition(APlayerState* Playe
 }
 #pragma endregion 
 
+#pragma region "Game status"
+void AAccelByteWarsInGameGameMode::UpdateGameStatus()
+{
+	ACCELBYTEWARS_FRAME_SCOPE(GameStatus);
+
+	// BeginPlay sets up the game data and requests the first update
+	if (!HasActorBegunPlay())
+	{
+		return;
+	}
+
+	// run or pause the countdowns for the current state, they only replicate when this changes
+	UpdateCountdownTimers();
+	const double ServerTime = ABInGameGameState->GetServerWorldTimeSeconds();
+	const EGameStatus PreviousGameStatus = ABInGameGameState->GameStatus;
+
+	switch (ABInGameGameState->GameStatus)
+	{
+	case EGameStatus::IDLE:
+	case EGameStatus::AWAITING_PLAYERS:
+		// check if all registered players have re-enter the server
+		if (ABInGameGameState->PlayerArray.Num() == ABInGameGameState->GetRegisteredPlayersNum())
+		{
+			ABInGameGameState->GameStatus = EGameStatus::PRE_GAME_COUNTDOWN_STARTED;
+			if (IsRunningDedicatedServer())
+			{
+				// reset NotEnoughPlayerCountdown
+				SetupShutdownCountdownsValue();
+			}
+		}
+		else
+		{
+			// use NotEnoughPlayerCountdown as a countdown to wait all registered player to reconnect to the DS
+			if (IsRunningDedicatedServer())
+			{
+				NotEnoughPlayerCountdownCounting();
+			}
+		}
+		break;
+	case EGameStatus::PRE_GAME_COUNTDOWN_STARTED:
+		if (ABInGameGameState->PreGameCountdownTimer.GetRemaining(ServerTime) <= 0)
+		{
+			// a short countdown on a cold server ends before the gameplay classes are loaded, the first spawns would load them
+			if (IsPreloadingGameplayClasses())
+			{
+				if (GameplayClassesWaitStartTime < 0.0)
+				{
+					GameplayClassesWaitStartTime = FPlatformTime::Seconds();
+					GAMEMODE_LOG(Log, TEXT("Pre-game countdown over, waiting for gameplay class preloads"));
+				}
+				break;
+			}
+
+			ABInGameGameState->GameStatus = EGameStatus::GAME_STARTED;
+			StartGame();
+		}
+		break;
+	case EGameStatus::AWAITING_PLAYERS_MID_GAME:
+		if (IsRunningDedicatedServer())
+		{
+			if (ShouldStartNotEnoughPlayerCountdown())
+			{
+				NotEnoughPlayerCountdownCounting();
+			}
+			else
+			{
+				ABInGameGameState->GameStatus = EGameStatus::GAME_STARTED;
+				SetupShutdownCountdownsValue();
+			}
+		}
+		break;
+	case EGameStatus::GAME_STARTED:
+		if (IsRunningDedicatedServer())
+		{
+			if (ShouldStartNotEnoughPlayerCountdown())
+			{
+				ABInGameGameState->GameStatus = EGameStatus::AWAITING_PLAYERS_MID_GAME;
+			}
+		}
+
+		// Gameplay timer
+		if (ABInGameGameState->TimeLeftTimer.GetRemaining(ServerTime) <= 0)
+		{
+			EndGame("Time is over");
+		}
+		break;
+	case EGameStatus::GAME_ENDS_DELAY:
+		// GameEndsDelayTimerHandle moves on to GAME_ENDS
+		break;
+	case EGameStatus::GAME_ENDS:
+		if (IsRunningDedicatedServer() && ABInGameGameState->GameSetup.GameEndsShutdownCountdown != INDEX_NONE)
+		{
+			if (ABInGameGameState->PostGameCountdownTimer.GetRemaining(ServerTime) <= 0)
+			{
+				CloseGame("Game finished");
+			}
+		}
+		break;
+	case EGameStatus::INVALID:
+		break;
+	default: ;
+	}
+
+	// one transition per update, the new status is evaluated right after
+	if (ABInGameGameState->GameStatus != PreviousGameStatus)
+	{
+		RequestGameStatusUpdate();
+	}
+
+	ScheduleCountdownExpiry();
+	UpdateServerTickRate();
+}
+
+void AAccelByteWarsInGameGameMode::RequestGameStatusUpdate()
+{
+	if (GetWorldTimerManager().IsTimerActive(GameStatusUpdateTimerHandle))
+	{
+		return;
+	}
+
+	GameStatusUpdateTimerHandle = GetWorldTimerManager().SetTimerForNextTick(this, &ThisClass::UpdateGameStatus);
+}
+
+void AAccelByteWarsInGameGameMode::SetIdleServerTickRate(const int32 NewTickRate)
+{
+	IdleServerTickRate = NewTickRate;
+	UpdateServerTickRate();
+}
+
+void AAccelByteWarsInGameGameMode::UpdateServerTickRate()
+{
+	if (!IsRunningDedicatedServer())
+	{
+		return;
+	}
+
+	UNetDriver* NetDriver = GetNetDriver();
+	if (!NetDriver)
+	{
+		return;
+	}
+
+	// the countdowns keep running on timers, they only fire up to one idle tick late.
+	// IdleServerTickRate set to 0 at runtime restores the full tick rate on the next update
+	const bool bGameEndedForEveryClient = ABInGameGameState->GameStatus == EGameStatus::GAME_ENDS && !bClientJoinedAfterGameEnded;
+	const bool bShouldThrottle = IdleServerTickRate > 0 && (NetDriver->ClientConnections.IsEmpty() || bGameEndedForEveryClient);
+	const bool bIsThrottled = FullServerTickRate != INDEX_NONE;
+	if (bShouldThrottle == bIsThrottled)
+	{
+		return;
+	}
+
+	if (bShouldThrottle)
+	{
+		FullServerTickRate = NetDriver->GetNetServerMaxTickRate();
+		NetDriver->SetNetServerMaxTickRate(FMath::Min(IdleServerTickRate, FullServerTickRate));
+		GAMEMODE_LOG(Log, TEXT("Server idle, tick rate lowered from %d to %d"), FullServerTickRate, NetDriver->GetNetServerMaxTickRate());
+	}
+	else
+	{
+		NetDriver->SetNetServerMaxTickRate(FullServerTickRate);
+		FullServerTickRate = INDEX_NONE;
+		GAMEMODE_LOG(Log, TEXT("Server active, tick rate restored to %d"), NetDriver->GetNetServerMaxTickRate());
+	}
+}
+
+void AAccelByteWarsInGameGameMode::OnGameStateTeamsChanged()
+{
+	bLivingTeamsDirty = true;
+	RequestGameStatusUpdate();
+}
+#pragma endregion
+
 #pragma region "Countdown related"
 bool AAccelByteWarsInGameGameMode::ShouldStartNotEnoughPlayerCountdown() const
 {
@@ -739,11 +1045,10 @@ bool AAccelByteWarsInGameGameMode::ShouldStartNotEnoughPlayerCountdown() const
 	return GetLivingTeamCount() < ABInGameGameState->GameSetup.MinimumTeamCountToPreventAutoShutdown;
 }
 
-void AAccelByteWarsInGameGameMode::NotEnoughPlayerCountdownCounting(const float& DeltaSeconds) const
+void AAccelByteWarsInGameGameMode::NotEnoughPlayerCountdownCounting() const
 {
-	// start NotEnoughPlayerCountdown to trigger server shutdown
-	ABInGameGameState->NotEnoughPlayerCountdown -= DeltaSeconds;
-	if (ABInGameGameState->NotEnoughPlayerCountdown <= 0)
+	// NotEnoughPlayerCountdown is running, trigger server shutdown once it runs out
+	if (ABInGameGameState->NotEnoughPlayerCountdownTimer.GetRemaining(ABInGameGameState->GetServerWorldTimeSeconds()) <= 0)
 	{
 		CloseGame("Not enough player");
 	}
@@ -751,152 +1056,166 @@ void AAccelByteWarsInGameGameMode::NotEnoughPlayerCountdownCounting(const float&
 
 void AAccelByteWarsInGameGameMode::SetupShutdownCountdownsValue() const
 {
-	ABInGameGameState->PostGameCountdown = ABInGameGameState->GameSetup.GameEndsShutdownCountdown;
-	ABInGameGameState->NotEnoughPlayerCountdown = ABInGameGameState->GameSetup.NotEnoughPlayerShutdownCountdown;
+	ABInGameGameState->PostGameCountdownTimer.Set(ABInGameGameState->GameSetup.GameEndsShutdownCountdown);
+	ABInGameGameState->NotEnoughPlayerCountdownTimer.Set(ABInGameGameState->GameSetup.NotEnoughPlayerShutdownCountdown);
 }
-#pragma endregion
 
-#pragma region "Gameplay logic math helper"
-bool AAccelByteWarsInGameGameMode::FindGoodSpawnLocation(
-	FVector2D& OutCoord,
-	const TArray<FVector>& ActiveGameObjectsCoords,
-	const FVector2D& MinBound,
-	const FVector2D& MaxBound) const
+void AAccelByteWarsInGameGameMode::UpdateCountdownTimers() const
 {
-	// Calculate prohibited area size
-	double AreaProhibited = 0.0;
-	for (const FVector& CircleCoord : ActiveGameObjectsCoords)
-	{
-		// assuming all object takes the shape of a circle with Z as the radius
-		// closest distance between circle's center to box's outer rim
-		float d = FMath::Sqrt(
-			FMath::Square(FMath::Min(FMath::Max(CircleCoord.X, MinBound.X), MaxBound.X) - CircleCoord.X) +
-			FMath::Square(FMath::Min(FMath::Max(CircleCoord.Y, MinBound.Y), MaxBound.Y) - CircleCoord.Y));
-		float OverlapArea =
-			FMath::Square(CircleCoord.Z) *
-			FMath::Acos(d / (2 * CircleCoord.Z)) -
-			((d / 2) - FMath::Sqrt(
-				FMath::Square(CircleCoord.Z) -
-				FMath::Square(d / 2)));
-
-		// if NaN, meaning the circle is entirely outside the bounding box
-		if (FMath::IsNaN(OverlapArea))
+	const EGameStatus GameStatus = ABInGameGameState->GameStatus;
+
+	bool bNotEnoughPlayerCounting = false;
+	if (IsRunningDedicatedServer())
+	{
+		switch (GameStatus)
 		{
-			OverlapArea = 0;
+		case EGameStatus::IDLE:
+		case EGameStatus::AWAITING_PLAYERS:
+			// waiting for all registered players to reconnect to the DS
+			bNotEnoughPlayerCounting = ABInGameGameState->PlayerArray.Num() != ABInGameGameState->GetRegisteredPlayersNum();
+			break;
+		case EGameStatus::AWAITING_PLAYERS_MID_GAME:
+			bNotEnoughPlayerCounting = ShouldStartNotEnoughPlayerCountdown();
+			break;
+		default: ;
 		}
-
-		AreaProhibited += OverlapArea;
 	}
 
-	// Calculate total play area size
-	const double Width = (MaxBound.X - MinBound.X);
-	const double Height = (MaxBound.Y - MinBound.Y);
-	const double AreaTotal = UKismetMathLibrary::Abs(Width * Height);
+	const bool bPostGameCounting = GameStatus == EGameStatus::GAME_ENDS &&
+		IsRunningDedicatedServer() &&
+		ABInGameGameState->GameSetup.GameEndsShutdownCountdown != INDEX_NONE;
+
+	const double ServerTime = ABInGameGameState->GetServerWorldTimeSeconds();
+	// paused at zero while waiting for the gameplay class preloads, their completion requests the next update
+	ABInGameGameState->PreGameCountdownTimer.SetRunning(
+		GameStatus == EGameStatus::PRE_GAME_COUNTDOWN_STARTED && GameplayClassesWaitStartTime < 0.0,
+		ServerTime);
+	ABInGameGameState->TimeLeftTimer.SetRunning(GameStatus == EGameStatus::GAME_STARTED, ServerTime);
+	ABInGameGameState->PostGameCountdownTimer.SetRunning(bPostGameCounting, ServerTime);
+	ABInGameGameState->NotEnoughPlayerCountdownTimer.SetRunning(bNotEnoughPlayerCounting, ServerTime);
+}
 
-	// Calculate allowable area size
-	const double AreaAllowed = AreaTotal - AreaProhibited;
+void AAccelByteWarsInGameGameMode::ScheduleCountdownExpiry()
+{
+	// the status may have just changed, run its countdowns before looking for the nearest one
+	UpdateCountdownTimers();
+
+	const double ServerTime = ABInGameGameState->GetServerWorldTimeSeconds();
+	float NearestExpiry = TNumericLimits<float>::Max();
+	for (const FAccelByteWarsCountdown* Countdown : {
+		&ABInGameGameState->PreGameCountdownTimer,
+		&ABInGameGameState->TimeLeftTimer,
+		&ABInGameGameState->PostGameCountdownTimer,
+		&ABInGameGameState->NotEnoughPlayerCountdownTimer})
+	{
+		if (Countdown->IsRunning())
+		{
+			NearestExpiry = FMath::Min(NearestExpiry, Countdown->GetRemaining(ServerTime));
+		}
+	}
 
-	// Negative value means not enough room in the game play area -> skip spawn
-	if (AreaAllowed < 0)
+	if (NearestExpiry == TNumericLimits<float>::Max())
 	{
-		GAMEMODE_LOG(Warning, TEXT("Not enough room, skipping spawn."), *MaxBound.ToString());
-		return false;
+		GetWorldTimerManager().ClearTimer(CountdownTimerHandle);
+		return;
 	}
 
-	// Random value within the allowable area
-	double RelativeLocation = static_cast<float>(UKismetMathLibrary::RandomIntegerInRange(0, AreaAllowed));
+	// a zero rate would clear the timer, an expired countdown is handled on the next tick
+	GetWorldTimerManager().SetTimer(CountdownTimerHandle, this, &ThisClass::UpdateGameStatus, FMath::Max(NearestExpiry, KINDA_SMALL_NUMBER), false);
+}
+#pragma endregion
 
-	OutCoord = CalculateActualCoord(RelativeLocation, MinBound, Width);
+#pragma region "Gameplay logic math helper"
+bool AAccelByteWarsInGameGameMode::FindGoodSpawnLocation(
+	FVector2D& OutCoord,
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound)
+{
+	EnsureSpawnLocationGrid();
 
-	// check if "overlapped" with existing objects
-	bool bUpdated = true;
-	while (bUpdated)
-	{
-		bUpdated = false;
-		for (const FVector& CircleCoord : ActiveGameObjectsCoords)
-		{
-			if (IsInsideCircle(OutCoord, CircleCoord))
-			{
-				// Add the X axis length inside the circle on the specified Y to the RelativeLocation
-				RelativeLocation += CalculateCircleLengthAlongXonY(CircleCoord, OutCoord.Y);
-				OutCoord = CalculateActualCoord(RelativeLocation, MinBound, Width);
+	// follows FMath's seed, see -MatchRandomSeed
+	FRandomStream Random(FMath::Rand());
 
-				bUpdated = true;
-				break;
-			}
-		}
+	if (!SpawnLocationGrid.FindLocation(
+		MinBound,
+		MaxBound,
+		[this](const FVector2D& Location) { return IsAwayFromShips(Location); },
+		Random,
+		OutCoord))
+	{
+		// crowded arenas fall back every respawn, the callers that can't use the fallback warn about it
+		GAMEMODE_LOG(Verbose, TEXT("Not enough room in %s - %s."), *MinBound.ToString(), *MaxBound.ToString());
+		return false;
 	}
 
 	return true;
 }
 
-bool AAccelByteWarsInGameGameMode::IsInsideCircle(const FVector2D& Target, const FVector& Circle) const
+void AAccelByteWarsInGameGameMode::EnsureSpawnLocationGrid()
 {
-	const double a = FMath::Pow(FMath::Pow(Circle.Z, 2.0) - FMath::Pow(Target.X - Circle.X, 2.0), 0.5);
-	return
-		Target.Y < Circle.Y + a && Target.Y > Circle.Y - a;
+	if (!bSpawnLocationGridDirty)
+	{
+		return;
+	}
+	bSpawnLocationGridDirty = false;
+
+	SpawnLocationGrid.Init(ABInGameGameState->MinGameBound, ABInGameGameState->MaxGameBound, SpawnLocationGridCellSize);
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& StaticBodies = ABInGameGameState->GetStaticBodies();
+	const TArray<FVector>& StaticBodyPositions = ABInGameGameState->GetStaticBodyPositions();
+	for (int32 i = 0; i < StaticBodies.Num(); ++i)
+	{
+		const FVector& Position = StaticBodyPositions[i];
+		SpawnLocationGrid.AddBlocker(StaticBodies[i], FVector2D(Position.X, Position.Y), Position.Z + ObjectSafeDistance);
+	}
 }
 
-double AAccelByteWarsInGameGameMode::CalculateCircleLengthAlongXonY(const FVector& Circle, const double Ycoord) const
+bool AAccelByteWarsInGameGameMode::IsAwayFromShips(const FVector2D& Location) const
 {
-	const double a = FMath::Pow(Circle.Z, 2.0) - FMath::Pow(Ycoord - Circle.Y, 2.0);
-	if (a < 0.0)
+	// ships spawned earlier in the same frame count too
+	for (const FVector& Ship : ABInGameGameState->GetShipPositions())
 	{
-		// This shouldn't happened if this is called only if IsInsideCircle return true. Just in case.
-		return 0.0;
+		if (FVector2D::DistSquared(Location, FVector2D(Ship.X, Ship.Y)) < FMath::Square(Ship.Z + ObjectSafeDistance))
+		{
+			return false;
+		}
 	}
-
-	const double Xrel = FMath::Pow(a, 0.5);
-	const double Xabs1 = Circle.X + Xrel;
-	const double Xabs2 = Circle.X - Xrel;
-
-	return FMath::Abs(Xabs1 - Xabs2);
+	return true;
 }
 
-FVector2D AAccelByteWarsInGameGameMode::CalculateActualCoord(
-	const double RelativeLocation,
-	const FVector2D& MinBound,
-	const double RangeX) const
+bool AAccelByteWarsInGameGameMode::LocationHasLineOfSightToOtherShip(const FVector& PositionToTest) const
 {
-	FVector2D OutLocation;
-
-	OutLocation.X = FMath::Fmod(RelativeLocation, RangeX) + MinBound.X;
-	OutLocation.Y = (RelativeLocation / RangeX) + MinBound.Y;
-
-	return OutLocation;
+	// only planets and stars block the line of sight
+	return HasLineOfSightToAny(
+		FVector2D(PositionToTest.X, PositionToTest.Y),
+		ABInGameGameState->GetShipPositions(),
+		ABInGameGameState->GetStaticBodyPositions());
 }
 
-bool AAccelByteWarsInGameGameMode::LocationHasLineOfSightToOtherShip(const FVector& PositionToTest) const
+bool AAccelByteWarsInGameGameMode::HasLineOfSightToAny(
+	const FVector2D& From,
+	const TArrayView<const FVector> Targets,
+	const TArrayView<const FVector> Bodies)
 {
-	TArray<AActor*> PawnActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APawn::StaticClass(), PawnActors);
-	for (const AActor* PawnActor : PawnActors)
+	for (const FVector& Target : Targets)
 	{
-		// check if pawn has line of sight to objects other than ship
-		bool bHasLineOfSightOther = true;
-		for (const UAccelByteWarsGameplayObjectComponent* Object : ABInGameGameState->ActiveGameObjects)
-		{
-			if (!Object)
-			{
-				continue;
-			}
+		const FVector2D Segment = FVector2D(Target.X, Target.Y) - From;
+		const double SegmentLengthSquared = Segment.SizeSquared();
 
-			if (Object->ObjectType == EGameplayObjectType::SHIP)
-			{
-				continue;
-			}
-
-			const float Radius = Object->Radius * 100.0f;
-			const float DistanceToSegment = UKismetMathLibrary::GetPointDistanceToSegment(
-				Object->GetOwner()->GetActorLocation(), PositionToTest, PawnActor->GetActorLocation());
-			if (DistanceToSegment < Radius)
+		bool bBlocked = false;
+		for (const FVector& Body : Bodies)
+		{
+			// closest point of the segment to the body's center
+			const FVector2D BodyCenter(Body.X, Body.Y);
+			const double T = SegmentLengthSquared > SMALL_NUMBER ?
+				FMath::Clamp(FVector2D::DotProduct(BodyCenter - From, Segment) / SegmentLengthSquared, 0.0, 1.0) : 0.0;
+			if (FVector2D::DistSquared(From + Segment * T, BodyCenter) < FMath::Square(Body.Z))
 			{
-				bHasLineOfSightOther = false;
+				bBlocked = true;
 				break;
 			}
 		}
 
-		if (bHasLineOfSightOther)
+		if (!bBlocked)
 		{
 			return true;
 		}
@@ -942,12 +1261,13 @@ void AAccelByteWarsInGameGameMode::ResetPlanets()
 		}
 	}
 
-	// remove planets from game state
-	for (UAccelByteWarsGameplayObjectComponent* Component : ABInGameGameState->ActiveGameObjects)
+	// remove planets from game state, iterate a copy as removing modifies the array
+	const TArray<UAccelByteWarsGameplayObjectComponent*> GameObjects = ABInGameGameState->ActiveGameObjects;
+	for (UAccelByteWarsGameplayObjectComponent* Component : GameObjects)
 	{
 		if (Component->ObjectType != EGameplayObjectType::SHIP)
 		{
-			ABInGameGameState->ActiveGameObjects.Remove(Component);
+			ABInGameGameState->RemoveActiveGameObject(Component);
 		}
 	}
 
@@ -962,6 +1282,7 @@ void AAccelByteWarsInGameGameMode::SetPlanetTargetNum(const int32 NewTarget)
 void AAccelByteWarsInGameGameMode::SetObjectSafeDistance(float NewDistance)
 {
 	ObjectSafeDistance = NewDistance;
+	bSpawnLocationGridDirty = true;
 }
 
 void AAccelByteWarsInGameGameMode::DrawBoundingBoxOnNextSpawn(const bool bDraw)
@@ -980,4 +1301,5 @@ void AAccelByteWarsInGameGameMode::ModifyGameBoundExtendModifier(const float New
 	ABInGameGameState->MinGameBoundExtend =
 		{ABInGameGameState->MinGameBound.X - NewHalfWidth, ABInGameGameState->MinGameBound.Y - NewHalfHeight};
 }
-#pragma endregion 
+
+#pragma endregion
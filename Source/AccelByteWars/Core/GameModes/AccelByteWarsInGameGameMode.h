@@ -7,10 +7,14 @@
 #include "CoreMinimal.h"
 #include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
 #include "Core/GameModes/AccelByteWarsGameMode.h"
+#include "Core/GameModes/AccelByteWarsLivingTeams.h"
+#include "Core/GameModes/AccelByteWarsSpawnLocationGrid.h"
 #include "Core/GameStates/AccelByteWarsInGameGameState.h"
 #include "Engine/SCS_Node.h"
 #include "AccelByteWarsInGameGameMode.generated.h"
 
+class FAccelByteWarsDiskPlacement;
+
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnPlayerDieDelegate, const APlayerController* /*Player*/, const AActor* /*PlayerActor*/, const APlayerController* /*Killer*/);
 
 USTRUCT(BlueprintType)
@@ -71,9 +75,43 @@ private:
 
 	float GameEndsDelay = 1.0f;
 
+	FTimerHandle GameStatusUpdateTimerHandle;
+	FTimerHandle CountdownTimerHandle;
+	FTimerHandle GameEndsDelayTimerHandle;
+
 	UPROPERTY()
 	AAccelByteWarsInGameGameState* ABInGameGameState = nullptr;
 
+	/**
+	 * @brief Free space left by planets and stars, updated as they enter or leave ActiveGameObjects
+	 */
+	FAccelByteWarsSpawnLocationGrid SpawnLocationGrid;
+
+	bool bSpawnLocationGridDirty = true;
+
+	/**
+	 * @brief Teams of the players in PlayerArray with lives left, updated per death and logout.
+	 * Rebuilt on next use after team members changed.
+	 */
+	mutable FAccelByteWarsLivingTeams LivingTeams;
+
+	mutable bool bLivingTeamsDirty = true;
+
+	/**
+	 * @brief Net driver tick rate to go back to while the server is throttled, INDEX_NONE when it is not
+	 */
+	int32 FullServerTickRate = INDEX_NONE;
+
+	/**
+	 * @brief Whether a client logged in during GAME_ENDS, the server then keeps its full tick rate for the results screen
+	 */
+	bool bClientJoinedAfterGameEnded = false;
+
+	/**
+	 * @brief Platform time the pre-game countdown ran out while gameplay classes were still loading, negative otherwise
+	 */
+	double GameplayClassesWaitStartTime = -1.0;
+
 protected:
 	UPROPERTY(EditAnywhere)
 	TArray<TSubclassOf<AActor>> ObjectsToSpawn;
@@ -93,6 +131,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawn Settings")
 	float SafeZone = 150.0f;
 
+	// Resolution of the free space used to find ship and worm hole spawn locations
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawn Settings")
+	float SpawnLocationGridCellSize = 50.0f;
+
+	// Ship spawn candidates tried for one out of the other ships' line of sight, 1 spawns at the first free location
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawn Settings")
+	int32 HiddenSpawnCandidates = 4;
+
 	// Maximum number of planets to be spawn
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Spawn Settings")
 	int32 MaxTargetPlanetCount = 5;
@@ -104,13 +150,19 @@ public:
 	// gap between objects
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Spawn Settings")
 	float ObjectSafeDistance = 400.0f;
+
+	// Dedicated server tick rate while no client is connected or after the game ends. 0 keeps the full tick rate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Server Settings")
+	int32 IdleServerTickRate = 5;
 #pragma endregion
 
 	//~AGameModeBase overridden functions
 	virtual void InitGameState() override;
 	virtual void BeginPlay() override;
 	virtual void Tick(float DeltaSeconds) override;
+	virtual void PreLogin(const FString& Options, const FString& Address, const FUniqueNetIdRepl& UniqueId, FString& ErrorMessage) override;
 	virtual void PostLogin(APlayerController* NewPlayer) override;
+	virtual void Logout(AController* Exiting) override;
 	//~End of AGameModeBase overridden functions
 
 	/**
@@ -166,6 +218,12 @@ private:
 	UFUNCTION()
 	void RemoveFromActiveGameObjects(AActor* DestroyedActor);
 
+	UFUNCTION()
+	void OnGameObjectAdded(UAccelByteWarsGameplayObjectComponent* Component);
+
+	UFUNCTION()
+	void OnGameObjectRemoved(UAccelByteWarsGameplayObjectComponent* Component);
+
 protected:
 	UFUNCTION(BlueprintImplementableEvent)
 	void OnShipDestroyedFX(
@@ -177,55 +235,134 @@ protected:
 private:
 	void CloseGame(const FString& Reason) const;
 	void StartGame();
+
+	/**
+	 * @brief Resolve the pawn class and the classes it spawns by path in the background, the game starts once they are done
+	 */
+	void PreloadGameplayClasses();
+
+	bool IsPreloadingGameplayClasses() const;
+
 	void SetupGameplayObject(AActor* Object) const;
 	int32 GetLivingTeamCount() const;
+
+	/**
+	 * @brief Update LivingTeams after PlayerState's lives or team changed
+	 */
+	void UpdateLivingPlayer(const APlayerState* PlayerState);
 	void SpawnAndPossesPawn(APlayerState* PlayerState);
 
-	TArray<FVector> GetActiveGameObjectsPosition() const;
 public:
 	/**
 	 * @brief Find randomize spawn location that is not occupied with other object and within the gameplay 
+	 * @param OutCoord Calculated coord, the least crowded spot of the gameplay area if no free location was found
+	 * @return false if OutCoord is the fallback, OutCoord is set either way
 	 */
 	bool FindGoodSpawnLocation(FVector2D& OutCoord);
+
+	/**
+	 * @brief Area planets spawn in, PlanetSpawnAreaPercentage of the game bound
+	 */
+	void GetPlanetSpawnArea(FVector2D& MinBound, FVector2D& MaxBound) const;
+
+	/**
+	 * @brief Initialize Placement over the given area with the objects in play as obstacles
+	 */
+	void SetupPlanetPlacement(FAccelByteWarsDiskPlacement& Placement, const FVector2D& MinBound, const FVector2D& MaxBound) const;
+
+	const TMap<int32, FPlanetMetadata>& GetPlanetMap() const { return PlanetMap; }
+
 private:
 	void SpawnPlanets();
-	bool FindGoodPlanetPosition(FVector& Position) const;
-	
+
 	// #jog afif Need to replace team id with player id
-	FVector FindGoodPlayerPosition(APlayerState* PlayerState) const;
+	FVector FindGoodPlayerPosition(APlayerState* PlayerState);
 
 protected:
 	UFUNCTION()
 	APawn* CreatePlayerPawn(const FVector& Location, APlayerController* PlayerController);
 #pragma endregion 
 
+#pragma region "Game status"
+public:
+	/**
+	 * @brief Change IdleServerTickRate and apply it right away, 0 runs at the full tick rate
+	 */
+	void SetIdleServerTickRate(const int32 NewTickRate);
+
+private:
+	/**
+	 * @brief Run the EGameStatus state machine once. Called on events and when a countdown runs out, the game mode does not poll it.
+	 */
+	void UpdateGameStatus();
+
+	/**
+	 * @brief Schedule UpdateGameStatus for the next tick, several requests in the same frame result in a single update
+	 */
+	void RequestGameStatusUpdate();
+
+	/**
+	 * @brief Drop a dedicated server to IdleServerTickRate while no client is connected or the game has ended, restore the full
+	 * tick rate otherwise, and for good once a client logs in after the game ended. Called after every game status update
+	 * and when a client logs in.
+	 */
+	void UpdateServerTickRate();
+
+	UFUNCTION()
+	void OnGameStateTeamsChanged();
+#pragma endregion 
+
 #pragma region "Countdown related"
 private:
 	bool ShouldStartNotEnoughPlayerCountdown() const;
-	void NotEnoughPlayerCountdownCounting(const float& DeltaSeconds) const;
+	void NotEnoughPlayerCountdownCounting() const;
 	void SetupShutdownCountdownsValue() const;
+
+	/**
+	 * @brief Resume the countdowns that run in the current game status and pause the others
+	 */
+	void UpdateCountdownTimers() const;
+
+	/**
+	 * @brief Wake UpdateGameStatus up when the nearest running countdown runs out
+	 */
+	void ScheduleCountdownExpiry();
 #pragma endregion 
 
 #pragma region "Gameplay logic math helper"
+public:
+	/**
+	 * @brief Whether the segment from From to any of Targets misses every body
+	 * @param Targets X, Y location of the targets, Z is ignored
+	 * @param Bodies X, Y center and Z radius of the bodies blocking the line of sight
+	 */
+	static bool HasLineOfSightToAny(const FVector2D& From, const TArrayView<const FVector> Targets, const TArrayView<const FVector> Bodies);
+
 private:
 	/**
-	 * @brief Pseudorandom coordinate with a rectangle bounding box
-	 * @param OutCoord Calculated coord
-	 * @param ActiveGameObjectsCoords List of existing object coords that will be included in the pseudorandom algorithm
+	 * @brief Pseudorandom coordinate with a rectangle bounding box, away from every gameplay object. Bounded time.
+	 * @param OutCoord Calculated coord, a deterministic fallback if no free location was found
 	 * @param MinBound Spawn area min bound
 	 * @param MaxBound Spawn area max bound
 	 * @return true if good location found, false if area is too cramped
 	 */
 	bool FindGoodSpawnLocation(
 		FVector2D& OutCoord,
-		const TArray<FVector>& ActiveGameObjectsCoords,
 		const FVector2D& MinBound,
-		const FVector2D& MaxBound) const;
+		const FVector2D& MaxBound);
+
+	/**
+	 * @brief Build SpawnLocationGrid from ActiveGameObjects on first use and after ObjectSafeDistance changed
+	 */
+	void EnsureSpawnLocationGrid();
+
+	bool IsAwayFromShips(const FVector2D& Location) const;
 
-	bool IsInsideCircle(const FVector2D& Target, const FVector& Circle) const;
-	double CalculateCircleLengthAlongXonY(const FVector& Circle, const double Ycoord) const;
-	FVector2D CalculateActualCoord(const double RelativeLocation, const FVector2D& MinBound, const double RangeX) const;
+	/**
+	 * @brief Whether a ship in play could be hit in a straight line from PositionToTest, planets and stars block the line
+	 */
 	bool LocationHasLineOfSightToOtherShip(const FVector& PositionToTest) const;
+
 #pragma endregion 
 
 #pragma region "Debugging"
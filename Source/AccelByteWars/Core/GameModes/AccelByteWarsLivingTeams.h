@@ -0,0 +1,62 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Number of teams with at least one player with lives left, updated per player instead of recounted.
+ * Setting or removing a player costs two map operations, whatever the number of players.
+ */
+class FAccelByteWarsLivingTeams
+{
+public:
+	/**
+	 * @brief Add a player or update its team and lives
+	 * @param Key Identifies the player on update and removal, never dereferenced
+	 * @param TeamId Team of the player
+	 * @param NumLivesLeft Lives of the player, the team only counts players with lives left
+	 */
+	void SetPlayer(const void* Key, const int32 TeamId, const int32 NumLivesLeft)
+	{
+		RemovePlayer(Key);
+
+		if (NumLivesLeft > 0)
+		{
+			LivingPlayerTeamIds.Add(Key, TeamId);
+			NumLivingPlayersPerTeam.FindOrAdd(TeamId)++;
+		}
+	}
+
+	void RemovePlayer(const void* Key)
+	{
+		int32 TeamId;
+		if (!LivingPlayerTeamIds.RemoveAndCopyValue(Key, TeamId))
+		{
+			return;
+		}
+
+		int32& NumLivingPlayers = NumLivingPlayersPerTeam.FindChecked(TeamId);
+		if (--NumLivingPlayers == 0)
+		{
+			NumLivingPlayersPerTeam.Remove(TeamId);
+		}
+	}
+
+	void Reset()
+	{
+		LivingPlayerTeamIds.Reset();
+		NumLivingPlayersPerTeam.Reset();
+	}
+
+	int32 Num() const { return NumLivingPlayersPerTeam.Num(); }
+
+private:
+	// Team of every player with lives left
+	TMap<const void*, int32> LivingPlayerTeamIds;
+
+	// Players with lives left per team, teams without any are removed
+	TMap<int32, int32> NumLivingPlayersPerTeam;
+};
@@ -0,0 +1,142 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameModes/AccelByteWarsSpawnLocationGrid.h"
+
+void FAccelByteWarsSpawnLocationGrid::Init(const FVector2D& MinBound, const FVector2D& MaxBound, const float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	Origin = MinBound;
+	NumCellsX = FMath::Max(1, FMath::CeilToInt((MaxBound.X - MinBound.X) / CellSize));
+	NumCellsY = FMath::Max(1, FMath::CeilToInt((MaxBound.Y - MinBound.Y) / CellSize));
+
+	BlockedCounts.Reset();
+	BlockedCounts.SetNumZeroed(NumCellsX * NumCellsY);
+	Blockers.Reset();
+}
+
+void FAccelByteWarsSpawnLocationGrid::AddBlocker(const void* Key, const FVector2D& Center, const float Clearance)
+{
+	RemoveBlocker(Key);
+
+	const FVector Blocker(Center.X, Center.Y, Clearance);
+	Blockers.Add(Key, Blocker);
+	Stamp(Blocker, 1);
+}
+
+void FAccelByteWarsSpawnLocationGrid::RemoveBlocker(const void* Key)
+{
+	FVector Blocker;
+	if (Blockers.RemoveAndCopyValue(Key, Blocker))
+	{
+		Stamp(Blocker, -1);
+	}
+}
+
+bool FAccelByteWarsSpawnLocationGrid::FindLocation(
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound,
+	TFunctionRef<bool(const FVector2D&)> IsLocationFree,
+	FRandomStream& Random,
+	FVector2D& OutLocation) const
+{
+	const FBox2D Area(MinBound, MaxBound);
+	const FIntRect Range = GetCellRange(MinBound, MaxBound);
+
+	int32 NumFreeCells = 0;
+	for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+	{
+		for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+		{
+			NumFreeCells += BlockedCounts[Y * NumCellsX + X] == 0 ? 1 : 0;
+		}
+	}
+
+	// uniform over the free cells, a rejected cell costs one more scan
+	for (int32 Candidate = 0; Candidate < FMath::Min(MaxCandidates, NumFreeCells); ++Candidate)
+	{
+		int32 FreeCellIndex = Random.RandHelper(NumFreeCells);
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y && FreeCellIndex >= 0; ++Y)
+		{
+			for (int32 X = Range.Min.X; X <= Range.Max.X && FreeCellIndex >= 0; ++X)
+			{
+				if (BlockedCounts[Y * NumCellsX + X] != 0 || FreeCellIndex-- > 0)
+				{
+					continue;
+				}
+
+				// border cells may stick out of the area
+				const FBox2D CellBox = GetCellBox(X, Y).Overlap(Area);
+				const FVector2D Location(
+					FMath::Lerp(CellBox.Min.X, CellBox.Max.X, Random.GetFraction()),
+					FMath::Lerp(CellBox.Min.Y, CellBox.Max.Y, Random.GetFraction()));
+				if (IsLocationFree(Location))
+				{
+					OutLocation = Location;
+					return true;
+				}
+			}
+		}
+	}
+
+	// fallback: least blocked cell, nearest to the area's center on ties
+	const FVector2D AreaCenter = Area.GetCenter();
+	int32 BestCount = MAX_int32;
+	double BestDistanceSquared = TNumericLimits<double>::Max();
+	for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+	{
+		for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+		{
+			const int32 Count = BlockedCounts[Y * NumCellsX + X];
+			const FVector2D CellCenter = GetCellBox(X, Y).Overlap(Area).GetCenter();
+			const double DistanceSquared = FVector2D::DistSquared(CellCenter, AreaCenter);
+			if (Count < BestCount || (Count == BestCount && DistanceSquared < BestDistanceSquared))
+			{
+				BestCount = Count;
+				BestDistanceSquared = DistanceSquared;
+				OutLocation = CellCenter;
+			}
+		}
+	}
+
+	return false;
+}
+
+void FAccelByteWarsSpawnLocationGrid::Stamp(const FVector& Blocker, const int32 Delta)
+{
+	if (!IsInitialized())
+	{
+		return;
+	}
+
+	const FVector2D Center(Blocker.X, Blocker.Y);
+	const FIntRect Range = GetCellRange(Center - Blocker.Z, Center + Blocker.Z);
+	for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+	{
+		for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+		{
+			// blocked as soon as the closest point of the cell is inside the clearance
+			if (GetCellBox(X, Y).ComputeSquaredDistanceToPoint(Center) < FMath::Square(Blocker.Z))
+			{
+				BlockedCounts[Y * NumCellsX + X] += Delta;
+			}
+		}
+	}
+}
+
+FIntRect FAccelByteWarsSpawnLocationGrid::GetCellRange(const FVector2D& MinBound, const FVector2D& MaxBound) const
+{
+	// clamping keeps out of bound blockers and areas in the border cells
+	return FIntRect(
+		FMath::Clamp(FMath::FloorToInt((MinBound.X - Origin.X) / CellSize), 0, NumCellsX - 1),
+		FMath::Clamp(FMath::FloorToInt((MinBound.Y - Origin.Y) / CellSize), 0, NumCellsY - 1),
+		FMath::Clamp(FMath::FloorToInt((MaxBound.X - Origin.X) / CellSize), 0, NumCellsX - 1),
+		FMath::Clamp(FMath::FloorToInt((MaxBound.Y - Origin.Y) / CellSize), 0, NumCellsY - 1));
+}
+
+FBox2D FAccelByteWarsSpawnLocationGrid::GetCellBox(const int32 X, const int32 Y) const
+{
+	const FVector2D CellMin(Origin.X + X * CellSize, Origin.Y + Y * CellSize);
+	return FBox2D(CellMin, CellMin + FVector2D(CellSize, CellSize));
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Free space of the play area for spawn location queries, kept up to date per blocker.
+ * A cell counts the blockers whose clearance circle touches it, any point of a cell with no blocker is a valid location.
+ * Queries scan the cells of the requested area a bounded number of times and fall back to a deterministic location.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsSpawnLocationGrid
+{
+public:
+	/**
+	 * @brief Clear all blockers and cover a new area
+	 * @param MinBound Grid min bound
+	 * @param MaxBound Grid max bound
+	 * @param InCellSize Size of a single cell, in unreal unit
+	 */
+	void Init(const FVector2D& MinBound, const FVector2D& MaxBound, const float InCellSize);
+
+	/**
+	 * @brief Block every cell within Clearance of Center. Adding an existing key moves its blocker.
+	 * @param Key Identifies the blocker on removal, never dereferenced
+	 */
+	void AddBlocker(const void* Key, const FVector2D& Center, const float Clearance);
+
+	void RemoveBlocker(const void* Key);
+
+	bool IsInitialized() const { return !BlockedCounts.IsEmpty(); }
+
+	/**
+	 * @brief Pick a random location in the area, away from every blocker and accepted by IsLocationFree
+	 * @param MinBound Area min bound
+	 * @param MaxBound Area max bound
+	 * @param IsLocationFree Check for objects that are not blockers (e.g. moving ones), called at most MaxCandidates times
+	 * @param Random Random source, the result is deterministic for a given stream state
+	 * @param OutLocation Output: the location, or the center of the least blocked cell nearest to the area's center
+	 * if no candidate was accepted
+	 * @return false if OutLocation is the fallback
+	 */
+	bool FindLocation(
+		const FVector2D& MinBound,
+		const FVector2D& MaxBound,
+		TFunctionRef<bool(const FVector2D&)> IsLocationFree,
+		FRandomStream& Random,
+		FVector2D& OutLocation) const;
+
+	/**
+	 * @brief Free cells tried per query before falling back
+	 */
+	int32 MaxCandidates = 16;
+
+private:
+	void Stamp(const FVector& Blocker, const int32 Delta);
+	FIntRect GetCellRange(const FVector2D& MinBound, const FVector2D& MaxBound) const;
+	FBox2D GetCellBox(const int32 X, const int32 Y) const;
+
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellSize = 1.0f;
+	int32 NumCellsX = 0;
+	int32 NumCellsY = 0;
+
+	// Blockers touching each cell
+	TArray<int32> BlockedCounts;
+
+	// X, Y center, Z clearance, per blocker key
+	TMap<const void*, FVector> Blockers;
+};
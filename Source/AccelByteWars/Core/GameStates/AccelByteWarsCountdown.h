@@ -0,0 +1,76 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AccelByteWarsCountdown.generated.h"
+
+/**
+ * Countdown on the synchronized server clock (AGameStateBase::GetServerWorldTimeSeconds).
+ * While running only the end time is stored, so the struct changes, and replicates, on Set, Resume and Pause only.
+ * Every machine evaluates the remaining time locally.
+ */
+USTRUCT()
+struct FAccelByteWarsCountdown
+{
+	GENERATED_BODY()
+
+	/**
+	 * @brief Remaining seconds while paused
+	 */
+	UPROPERTY()
+	float PausedRemaining = 0.0f;
+
+	/**
+	 * @brief Server time at which the countdown reaches zero, negative while paused
+	 */
+	UPROPERTY()
+	double EndServerTime = -1.0;
+
+	bool IsRunning() const { return EndServerTime >= 0.0; }
+
+	float GetRemaining(const double ServerTime) const
+	{
+		return IsRunning() ? FMath::Max(0.0f, static_cast<float>(EndServerTime - ServerTime)) : PausedRemaining;
+	}
+
+	/**
+	 * @brief Set the remaining time, the countdown is paused until resumed
+	 */
+	void Set(const float Seconds)
+	{
+		PausedRemaining = Seconds;
+		EndServerTime = -1.0;
+	}
+
+	void Resume(const double ServerTime)
+	{
+		if (!IsRunning())
+		{
+			EndServerTime = ServerTime + PausedRemaining;
+		}
+	}
+
+	void Pause(const double ServerTime)
+	{
+		if (IsRunning())
+		{
+			PausedRemaining = GetRemaining(ServerTime);
+			EndServerTime = -1.0;
+		}
+	}
+
+	void SetRunning(const bool bRunning, const double ServerTime)
+	{
+		if (bRunning)
+		{
+			Resume(ServerTime);
+		}
+		else
+		{
+			Pause(ServerTime);
+		}
+	}
+};
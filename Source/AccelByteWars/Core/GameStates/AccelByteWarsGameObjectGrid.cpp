@@ -0,0 +1,116 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameStates/AccelByteWarsGameObjectGrid.h"
+
+#include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
+
+void FAccelByteWarsGameObjectGrid::Rebuild(
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& Objects,
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound,
+	const float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	Origin = MinBound;
+	NumCellsX = FMath::Max(1, FMath::CeilToInt((MaxBound.X - MinBound.X) / CellSize));
+	NumCellsY = FMath::Max(1, FMath::CeilToInt((MaxBound.Y - MinBound.Y) / CellSize));
+
+	const int32 NumCells = NumCellsX * NumCellsY;
+	CellStarts.Reset(NumCells + 1);
+	CellStarts.AddZeroed(NumCells + 1);
+	CellObjects.Reset();
+
+	// first pass: count objects per cell
+	for (const UAccelByteWarsGameplayObjectComponent* Object : Objects)
+	{
+		if (!Object || !Object->GetOwner())
+		{
+			continue;
+		}
+
+		const FIntRect Range = GetCellRange(Object->GetOwner()->GetActorLocation(), Object->Radius * 100.0f);
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+		{
+			for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+			{
+				CellStarts[Y * NumCellsX + X + 1]++;
+			}
+		}
+	}
+
+	// prefix sum, CellStarts[i] is now the first slot of cell i
+	for (int32 i = 1; i <= NumCells; ++i)
+	{
+		CellStarts[i] += CellStarts[i - 1];
+	}
+	CellObjects.SetNumZeroed(CellStarts[NumCells]);
+
+	// second pass: fill
+	TArray<int32> FillCursor(CellStarts.GetData(), NumCells);
+	for (UAccelByteWarsGameplayObjectComponent* Object : Objects)
+	{
+		if (!Object || !Object->GetOwner())
+		{
+			continue;
+		}
+
+		const FIntRect Range = GetCellRange(Object->GetOwner()->GetActorLocation(), Object->Radius * 100.0f);
+		for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+		{
+			for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+			{
+				CellObjects[FillCursor[Y * NumCellsX + X]++] = Object;
+			}
+		}
+	}
+}
+
+void FAccelByteWarsGameObjectGrid::Query(
+	const FVector& Location,
+	const float QueryRadius,
+	TArray<UAccelByteWarsGameplayObjectComponent*>& OutObjects) const
+{
+	if (CellStarts.IsEmpty())
+	{
+		return;
+	}
+
+	const FIntRect Range = GetCellRange(Location, QueryRadius);
+	for (int32 Y = Range.Min.Y; Y <= Range.Max.Y; ++Y)
+	{
+		for (int32 X = Range.Min.X; X <= Range.Max.X; ++X)
+		{
+			const int32 CellIndex = Y * NumCellsX + X;
+			for (int32 i = CellStarts[CellIndex]; i < CellStarts[CellIndex + 1]; ++i)
+			{
+				// objects spanning several cells are stored once per cell, candidate lists are small
+				OutObjects.AddUnique(CellObjects[i]);
+			}
+		}
+	}
+}
+
+void FAccelByteWarsGameObjectGrid::Reset()
+{
+	NumCellsX = 0;
+	NumCellsY = 0;
+	CellStarts.Reset();
+	CellObjects.Reset();
+}
+
+FIntPoint FAccelByteWarsGameObjectGrid::GetCellCoord(const double X, const double Y) const
+{
+	// clamping keeps out of bound objects and queries in the border cells, overlap is preserved
+	return FIntPoint(
+		FMath::Clamp(FMath::FloorToInt((X - Origin.X) / CellSize), 0, NumCellsX - 1),
+		FMath::Clamp(FMath::FloorToInt((Y - Origin.Y) / CellSize), 0, NumCellsY - 1));
+}
+
+FIntRect FAccelByteWarsGameObjectGrid::GetCellRange(const FVector& Location, const double Extent) const
+{
+	return FIntRect(
+		GetCellCoord(Location.X - Extent, Location.Y - Extent),
+		GetCellCoord(Location.X + Extent, Location.Y + Extent));
+}
@@ -0,0 +1,58 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAccelByteWarsGameplayObjectComponent;
+
+/**
+ * @brief Uniform grid over the play area used as a broadphase for gameplay object proximity queries.
+ * Objects are bucketed by their bounding circle (Radius * 100), cells are stored contiguously per cell.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsGameObjectGrid
+{
+public:
+	/**
+	 * @brief Re-bucket all objects. Objects outside the bound are clamped into the border cells.
+	 * @param Objects Objects to be indexed
+	 * @param MinBound Grid min bound
+	 * @param MaxBound Grid max bound
+	 * @param InCellSize Size of a single cell, in unreal unit
+	 */
+	void Rebuild(
+		const TArray<UAccelByteWarsGameplayObjectComponent*>& Objects,
+		const FVector2D& MinBound,
+		const FVector2D& MaxBound,
+		const float InCellSize);
+
+	/**
+	 * @brief Find objects whose bounding circle may be within QueryRadius of Location
+	 * @param Location Query center
+	 * @param QueryRadius Distance from Location to the objects' surface
+	 * @param OutObjects Output: candidate objects, each object is added once
+	 */
+	void Query(
+		const FVector& Location,
+		const float QueryRadius,
+		TArray<UAccelByteWarsGameplayObjectComponent*>& OutObjects) const;
+
+	void Reset();
+
+	bool IsEmpty() const { return CellObjects.IsEmpty(); }
+
+private:
+	FIntPoint GetCellCoord(const double X, const double Y) const;
+	FIntRect GetCellRange(const FVector& Location, const double Extent) const;
+
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellSize = 1.0f;
+	int32 NumCellsX = 0;
+	int32 NumCellsY = 0;
+
+	// Cell i owns CellObjects[CellStarts[i]..CellStarts[i + 1])
+	TArray<int32> CellStarts;
+	TArray<UAccelByteWarsGameplayObjectComponent*> CellObjects;
+};
@@ -5,6 +5,7 @@
 
 #include "AccelByteWarsGameState.h"
 
+#include "Core/System/AccelByteWarsFrameStats.h"
 #include "Core/System/AccelByteWarsGameInstance.h"
 #include "Net/UnrealNetwork.h"
 
@@ -16,7 +17,7 @@ void AAccelByteWarsGameState::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 
 	DOREPLIFETIME(ThisClass, GameSetup);
 	DOREPLIFETIME(ThisClass, bIsServerTravelling);
-	DOREPLIFETIME(ThisClass, Teams);
+	DOREPLIFETIME(ThisClass, ReplicatedTeams);
 
 	DOREPLIFETIME(ThisClass, SimulateServerCrashCountdown);
 }
@@ -37,6 +38,8 @@ void AAccelByteWarsGameState::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
 
+	ReplicatedTeams.Owner = this;
+
 	GameInstance = Cast<UAccelByteWarsGameInstance>(GetGameInstance());
 	if (!GameInstance)
 	{
@@ -49,6 +52,7 @@ void AAccelByteWarsGameState::PostInitializeComponents()
 	{
 		Teams = GameInstance->Teams;
 		GameSetup = GameInstance->GameSetup;
+		MarkTeamsDirty();
 		if (HasAuthority())
 		{
 			OnNotify_Teams();
@@ -61,6 +65,20 @@ void AAccelByteWarsGameState::PostInitializeComponents()
 	}
 }
 
+void AAccelByteWarsGameState::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	ACCELBYTEWARS_FRAME_SCOPE(Replication);
+
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// single players are synced as they change, only teams or players added, removed or moved need a diff
+	if (HasAuthority() && bReplicatedTeamsDirty)
+	{
+		ReplicatedTeams.SyncFromTeams(Teams);
+		bReplicatedTeamsDirty = false;
+	}
+}
+
 void AAccelByteWarsGameState::OnNotify_IsServerTravelling() const
 {
 	OnIsServerTravellingChanged.Broadcast();
@@ -71,9 +89,19 @@ void AAccelByteWarsGameState::OnNotify_Teams()
 	OnTeamsChanged.Broadcast();
 }
 
+void AAccelByteWarsGameState::OnReplicatedTeamsReceived(const TArray<FGameplayPlayerData>& ChangedMembers)
+{
+	ReplicatedTeams.BuildTeams(Teams);
+	MarkTeamsDirty();
+
+	OnNotify_Teams();
+	OnTeamMembersChanged.Broadcast(ChangedMembers);
+}
+
 void AAccelByteWarsGameState::EmptyTeams()
 {
 	Teams.Empty();
+	MarkTeamsDirty();
 	if (HasAuthority())
 	{
 		OnNotify_Teams();
@@ -208,7 +236,7 @@ TArray<int32> AAccelByteWarsGameState::GetRemainingTeams() const
 	TArray<int32> RemainingTeams;
 	for (const FGameplayTeamData& Team : Teams)
 	{
-		if (Team.GetTeamLivesLeft() > 0)
+		if (GetTeamLivesLeft(Team.TeamId) > 0)
 		{
 			RemainingTeams.AddUnique(Team.TeamId);
 		}
@@ -223,18 +251,73 @@ bool AAccelByteWarsGameState::GetTeamDataByTeamId(
 	int32& OutTeamLivesLeft,
 	int32& OutTeamKillCount)
 {
-	if (Teams.IsValidIndex(TeamId))
+	if (const FGameplayTeamData* TeamData = FindTeamData(TeamId))
 	{
-		OutTeamData = Teams[TeamId];
-		OutTeamScore = OutTeamData.GetTeamScore();
-		OutTeamLivesLeft = OutTeamData.GetTeamLivesLeft();
-		OutTeamKillCount = OutTeamData.GetTeamKillCount();
+		OutTeamData = *TeamData;
+		OutTeamScore = GetTeamScore(TeamId);
+		OutTeamLivesLeft = GetTeamLivesLeft(TeamId);
+		OutTeamKillCount = GetTeamKillCount(TeamId);
 
 		return true;
 	}
 	return false;
 }
 
+const FGameplayTeamData* AAccelByteWarsGameState::FindTeamData(const int32 TeamId) const
+{
+	// By design, TeamId represent Index in the array, until a team is emptied and removed
+	if (Teams.IsValidIndex(TeamId) && Teams[TeamId].TeamId == TeamId)
+	{
+		return &Teams[TeamId];
+	}
+	return Teams.FindByPredicate([TeamId](const FGameplayTeamData& Team) { return Team.TeamId == TeamId; });
+}
+
+float AAccelByteWarsGameState::GetTeamScore(const int32 TeamId) const
+{
+	const FAccelByteWarsTeamTotals* Totals = TeamTotals.Find(Teams, TeamId);
+	return Totals ? Totals->Score : 0.0f;
+}
+
+int32 AAccelByteWarsGameState::GetTeamLivesLeft(const int32 TeamId) const
+{
+	const FAccelByteWarsTeamTotals* Totals = TeamTotals.Find(Teams, TeamId);
+	return Totals ? Totals->LivesLeft : 0;
+}
+
+int32 AAccelByteWarsGameState::GetTeamKillCount(const int32 TeamId) const
+{
+	const FAccelByteWarsTeamTotals* Totals = TeamTotals.Find(Teams, TeamId);
+	return Totals ? Totals->KillCount : 0;
+}
+
+void AAccelByteWarsGameState::SetPlayerScore(FGameplayPlayerData& PlayerData, const float Score)
+{
+	TeamTotals.SetPlayerScore(PlayerData, Score);
+	MarkPlayerDataDirty(PlayerData);
+}
+
+void AAccelByteWarsGameState::SetPlayerKillCount(FGameplayPlayerData& PlayerData, const int32 KillCount)
+{
+	TeamTotals.SetPlayerKillCount(PlayerData, KillCount);
+	MarkPlayerDataDirty(PlayerData);
+}
+
+void AAccelByteWarsGameState::SetPlayerLivesLeft(FGameplayPlayerData& PlayerData, const int32 NumLivesLeft)
+{
+	TeamTotals.SetPlayerLivesLeft(PlayerData, NumLivesLeft);
+	MarkPlayerDataDirty(PlayerData);
+}
+
+void AAccelByteWarsGameState::MarkPlayerDataDirty(const FGameplayPlayerData& PlayerData)
+{
+	// a pending full sync picks the change up, a player without a slot yet needs one
+	if (HasAuthority() && !bReplicatedTeamsDirty && !ReplicatedTeams.SyncMember(PlayerData))
+	{
+		bReplicatedTeamsDirty = true;
+	}
+}
+
 bool AAccelByteWarsGameState::GetPlayerDataById(
 	const FUniqueNetIdRepl UniqueNetId,
 	FGameplayPlayerData& OutPlayerData,
@@ -252,16 +335,7 @@ FGameplayPlayerData* AAccelByteWarsGameState::GetPlayerDataById(
 	const FUniqueNetIdRepl UniqueNetId,
 	const int32 ControllerId)
 {
-	FGameplayPlayerData* PlayerData = nullptr;
-	for (FGameplayTeamData& Team : Teams)
-	{
-		PlayerData = Team.TeamMembers.FindByKey(FGameplayPlayerData{UniqueNetId, ControllerId});
-		if (PlayerData)
-		{
-			break;
-		}
-	}
-	return PlayerData;
+	return PlayerIndex.Find(Teams, UniqueNetId, ControllerId);
 }
 
 int32 AAccelByteWarsGameState::GetRegisteredPlayersNum() const
@@ -321,6 +395,7 @@ bool AAccelByteWarsGameState::AddPlayerToTeam(
 		KillCount,
 		OutLives
 	});
+	MarkTeamsDirty();
 
 	if (HasAuthority())
 	{
@@ -341,6 +416,8 @@ bool AAccelByteWarsGameState::RemovePlayerFromTeam(const FUniqueNetIdRepl Unique
 			bStatus = Team.TeamMembers.Remove(FGameplayPlayerData{UniqueNetId, ControllerId}) > 0;
 			if (bStatus)
 			{
+				MarkTeamsDirty();
+
 				if (HasAuthority())
 				{
 					OnNotify_Teams();
@@ -356,6 +433,8 @@ bool AAccelByteWarsGameState::RemovePlayerFromTeam(const FUniqueNetIdRepl Unique
 	if (AssignedTeamIndex != INDEX_NONE && Teams[AssignedTeamIndex].TeamMembers.IsEmpty())
 	{
 		Teams.RemoveAt(AssignedTeamIndex);
+		MarkTeamsDirty();
+
 		if (HasAuthority())
 		{
 			OnNotify_Teams();
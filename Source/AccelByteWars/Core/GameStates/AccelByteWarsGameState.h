@@ -7,6 +7,9 @@
 #include "CoreMinimal.h"
 #include "OnlineSessionSettings.h"
 #include "Core/System/AccelByteWarsGameInstance.h"
+#include "Core/GameStates/AccelByteWarsPlayerIndex.h"
+#include "Core/GameStates/AccelByteWarsReplicatedTeams.h"
+#include "Core/GameStates/AccelByteWarsTeamTotals.h"
 #include "GameFramework/GameStateBase.h"
 #include "AccelByteWarsGameState.generated.h"
 
@@ -18,6 +21,7 @@ ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsGameState, Log, Al
 
 #pragma region "Structs, Enums, and Delegates declaration"
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGameStateVoidDelegate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTeamMembersChanged, const TArray<FGameplayPlayerData>&, ChangedMembers);
 #pragma endregion 
 
 UCLASS()
@@ -30,6 +34,7 @@ public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void PostInitializeComponents() override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 	//~End of AActor overriden functions
 
 	/**
@@ -39,9 +44,9 @@ public:
 	FGameModeData GameSetup;
 
 	/**
-	 * @brief Teams info and data
+	 * @brief Teams info and data. Replicated through ReplicatedTeams, rebuilt on clients on every change.
 	 */
-	UPROPERTY(BlueprintReadWrite, Replicated, ReplicatedUsing = OnNotify_Teams)
+	UPROPERTY(BlueprintReadWrite)
 	TArray<FGameplayTeamData> Teams;
 
 	UPROPERTY(Replicated, ReplicatedUsing = OnNotify_IsServerTravelling)
@@ -53,6 +58,12 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FGameStateVoidDelegate OnTeamsChanged;
 
+	/**
+	 * @brief Client only, called after OnTeamsChanged with the members that were added, changed or removed
+	 */
+	UPROPERTY(BlueprintAssignable)
+	FOnTeamMembersChanged OnTeamMembersChanged;
+
 	// Static delegate to be called when the game state is initialized and replicated.
 	inline static FSimpleMulticastDelegate OnInitialized;
 
@@ -62,6 +73,8 @@ public:
 	UFUNCTION()
 	void OnNotify_Teams();
 
+	void OnReplicatedTeamsReceived(const TArray<FGameplayPlayerData>& ChangedMembers);
+
 	UFUNCTION(BlueprintCallable)
 	void EmptyTeams();
 
@@ -114,6 +127,45 @@ public:
 	 */
 	FGameplayPlayerData* GetPlayerDataById(const FUniqueNetIdRepl UniqueNetId, const int32 ControllerId = 0);
 
+	/**
+	 * @brief Team by Team Id, without copying it
+	 * @return nullptr if team not found
+	 */
+	const FGameplayTeamData* FindTeamData(const int32 TeamId) const;
+
+	/**
+	 * @brief Team totals by Team Id, kept up to date by the SetPlayer* functions instead of summed on every call
+	 */
+	float GetTeamScore(const int32 TeamId) const;
+	int32 GetTeamLivesLeft(const int32 TeamId) const;
+	int32 GetTeamKillCount(const int32 TeamId) const;
+
+	/**
+	 * @brief Update a member of Teams and its team's totals. Use these instead of writing the member's fields directly.
+	 * @param PlayerData Member of Teams, usually from GetPlayerDataById
+	 */
+	void SetPlayerScore(FGameplayPlayerData& PlayerData, const float Score);
+	void SetPlayerKillCount(FGameplayPlayerData& PlayerData, const int32 KillCount);
+	void SetPlayerLivesLeft(FGameplayPlayerData& PlayerData, const int32 NumLivesLeft);
+
+	/**
+	 * @brief Replicate a member of Teams whose other fields were written directly, e.g. its power-up selection
+	 * @param PlayerData Member of Teams, usually from GetPlayerDataById
+	 */
+	void MarkPlayerDataDirty(const FGameplayPlayerData& PlayerData);
+
+	/**
+	 * @brief Make the player index and team totals rebuild on next use, and Teams diffed on the next net update. Call after
+	 * adding, removing or moving members of Teams directly, including from blueprints, lookups miss the changed players until then.
+	 */
+	UFUNCTION(BlueprintCallable)
+	void MarkTeamsDirty()
+	{
+		PlayerIndex.MarkDirty();
+		TeamTotals.MarkDirty();
+		bReplicatedTeamsDirty = true;
+	}
+
 	/**
 	 * @brief Get player count registered in GameState's game data
 	 * @return Registered players count
@@ -162,6 +214,24 @@ private:
 	UPROPERTY()
 	UAccelByteWarsGameInstance* GameInstance = nullptr;
 
+	UPROPERTY(Replicated)
+	FAccelByteWarsReplicatedTeams ReplicatedTeams;
+
+	/**
+	 * @brief Server: Teams changed in a way SyncMember can't follow, sync all of it on the next net update
+	 */
+	bool bReplicatedTeamsDirty = true;
+
+	/**
+	 * @brief Where every player is in Teams, for GetPlayerDataById
+	 */
+	FAccelByteWarsPlayerIndex PlayerIndex;
+
+	/**
+	 * @brief Totals per team, by TeamId. Summed again lazily from const getters.
+	 */
+	mutable FAccelByteWarsTeamTotalsCache TeamTotals;
+
 	/**
 	 * @brief If true, store Teams and GameSetup to GameInstance before travel
 	 */
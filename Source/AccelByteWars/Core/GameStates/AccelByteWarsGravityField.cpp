@@ -0,0 +1,118 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameStates/AccelByteWarsGravityField.h"
+
+#include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
+
+void FAccelByteWarsGravityField::Rebuild(
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& Objects,
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound,
+	const float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	Origin = MinBound;
+	NumSamplesX = FMath::Max(1, FMath::CeilToInt((MaxBound.X - MinBound.X) / CellSize)) + 1;
+	NumSamplesY = FMath::Max(1, FMath::CeilToInt((MaxBound.Y - MinBound.Y) / CellSize)) + 1;
+	Signature = CalculateSignature(Objects, MinBound, MaxBound, InCellSize);
+
+	Samples.Reset(NumSamplesX * NumSamplesY);
+	Samples.AddZeroed(NumSamplesX * NumSamplesY);
+
+	for (const UAccelByteWarsGameplayObjectComponent* Object : Objects)
+	{
+		if (!IsStaticBody(Object))
+		{
+			continue;
+		}
+
+		const FVector BodyLocation = Object->GetOwner()->GetActorLocation();
+		const float a = Object->Mass * 50.0f;
+
+		// nothing survives inside a body, clamp there so samples around the surface stay finite
+		const float MinDistance = FMath::Max(Object->Radius * 100.0f, 1.0f);
+
+		for (int32 Y = 0; Y < NumSamplesY; ++Y)
+		{
+			for (int32 X = 0; X < NumSamplesX; ++X)
+			{
+				const FVector SampleLocation(Origin.X + X * CellSize, Origin.Y + Y * CellSize, BodyLocation.Z);
+				const FVector Delta = BodyLocation - SampleLocation;
+				const float c = FMath::Max(static_cast<float>(Delta.Size2D()), MinDistance);
+				const float d = FMath::Pow(c, 1.5f);
+				const FVector Direction = Delta.GetSafeNormal2D();
+				const FVector2f f(Direction.X, Direction.Y);
+
+				Samples[Y * NumSamplesX + X] += f * (a / d);
+			}
+		}
+	}
+}
+
+bool FAccelByteWarsGravityField::Sample(const FVector& Location, FVector& OutField) const
+{
+	if (Samples.IsEmpty())
+	{
+		return false;
+	}
+
+	const float LocalX = (Location.X - Origin.X) / CellSize;
+	const float LocalY = (Location.Y - Origin.Y) / CellSize;
+	const int32 X0 = FMath::FloorToInt(LocalX);
+	const int32 Y0 = FMath::FloorToInt(LocalY);
+	if (X0 < 0 || Y0 < 0 || X0 + 1 >= NumSamplesX || Y0 + 1 >= NumSamplesY)
+	{
+		return false;
+	}
+
+	const float AlphaX = LocalX - X0;
+	const float AlphaY = LocalY - Y0;
+	const int32 Index = Y0 * NumSamplesX + X0;
+
+	const FVector2f Bottom = FMath::Lerp(Samples[Index], Samples[Index + 1], AlphaX);
+	const FVector2f Top = FMath::Lerp(Samples[Index + NumSamplesX], Samples[Index + NumSamplesX + 1], AlphaX);
+	const FVector2f Value = FMath::Lerp(Bottom, Top, AlphaY);
+
+	OutField = FVector(Value.X, Value.Y, 0.0f);
+	return true;
+}
+
+void FAccelByteWarsGravityField::Reset()
+{
+	NumSamplesX = 0;
+	NumSamplesY = 0;
+	Signature = 0;
+	Samples.Reset();
+}
+
+uint32 FAccelByteWarsGravityField::CalculateSignature(
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& Objects,
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound,
+	const float InCellSize)
+{
+	uint32 Hash = HashCombine(GetTypeHash(MinBound), GetTypeHash(MaxBound));
+	Hash = HashCombine(Hash, GetTypeHash(InCellSize));
+
+	for (const UAccelByteWarsGameplayObjectComponent* Object : Objects)
+	{
+		if (!IsStaticBody(Object))
+		{
+			continue;
+		}
+
+		Hash = HashCombine(Hash, GetTypeHash(Object));
+		Hash = HashCombine(Hash, GetTypeHash(Object->GetOwner()->GetActorLocation()));
+		Hash = HashCombine(Hash, GetTypeHash(Object->Mass));
+		Hash = HashCombine(Hash, GetTypeHash(Object->Radius));
+	}
+
+	return Hash;
+}
+
+bool FAccelByteWarsGravityField::IsStaticBody(const UAccelByteWarsGameplayObjectComponent* Object)
+{
+	return Object && Object->GetOwner() && Object->ObjectType != EGameplayObjectType::SHIP;
+}
@@ -0,0 +1,83 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAccelByteWarsGameplayObjectComponent;
+
+/**
+ * @brief Precomputed gravity of the bodies that never move during a match (planets and stars), sampled on a regular grid.
+ * A sample holds the sum of (Mass * 50) * Direction / Distance^1.5 over the bodies, the force on a missile is
+ * GravitationalConstant * MissileMass * Sample, which matches AAccelByteWarsMissile::CalculateGravityForceToObject.
+ *
+ * The field is 2D: distances are measured with Size2D and samples have no Z, where the exact calculation is 3D.
+ * Both agree as long as the missiles fly on the plane of the bodies, which holds because every spawn and placement
+ * is done in 2D. A missile above or below that plane would get the in-plane pull it would have on the plane.
+ *
+ * Bilinear interpolation of a body's pull a * r^-1.5 is off by at most CellSize^2 / 8 * (|Fxx| + |Fyy|), about
+ * 0.85 * (CellSize / r)^2 of the pull, r being the distance from the body to the nearest sample of the cell.
+ * With the default 25 unit cell that is under 3% of the pull from 150 units away. Cells that cross a body's surface
+ * mix in the clamped samples inside of it and are off by up to about CellSize / (Radius * 100) of the pull at the
+ * surface, they are only reached by missiles about to hit that body. AccelByteWars.GameState.GravityFieldAccuracy
+ * checks both bounds.
+ *
+ * Rebuilding visits every sample once per static body, about 50k samples for the default 7500 x 4200 extended bounds
+ * and 25 unit cells, it only runs when a static body is spawned, moved or removed.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsGravityField
+{
+public:
+	/**
+	 * @brief Recompute every sample from the static bodies in Objects. Non static objects are ignored.
+	 * @param Objects Gameplay objects, usually the game state's ActiveGameObjects
+	 * @param MinBound Field min bound
+	 * @param MaxBound Field max bound
+	 * @param InCellSize Distance between two samples, in unreal unit
+	 */
+	void Rebuild(
+		const TArray<UAccelByteWarsGameplayObjectComponent*>& Objects,
+		const FVector2D& MinBound,
+		const FVector2D& MaxBound,
+		const float InCellSize);
+
+	/**
+	 * @brief Bilinear sample of the field
+	 * @param Location Sample location
+	 * @param OutField Output: field value at Location
+	 * @return false if Location is outside of the field, caller should fall back to the exact calculation
+	 */
+	bool Sample(const FVector& Location, FVector& OutField) const;
+
+	void Reset();
+
+	bool IsEmpty() const { return Samples.IsEmpty(); }
+
+	/**
+	 * @brief Hash of everything the field depends on. A different signature means the field needs to be rebuilt.
+	 */
+	static uint32 CalculateSignature(
+		const TArray<UAccelByteWarsGameplayObjectComponent*>& Objects,
+		const FVector2D& MinBound,
+		const FVector2D& MaxBound,
+		const float InCellSize);
+
+	/**
+	 * @brief Whether the object is part of the field. Ships move, so they are always calculated exactly.
+	 */
+	static bool IsStaticBody(const UAccelByteWarsGameplayObjectComponent* Object);
+
+	uint32 GetSignature() const { return Signature; }
+
+private:
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellSize = 1.0f;
+	int32 NumSamplesX = 0;
+	int32 NumSamplesY = 0;
+	uint32 Signature = 0;
+
+	// Row major, sample (X, Y) is at Origin + (X, Y) * CellSize
+	TArray<FVector2f> Samples;
+};
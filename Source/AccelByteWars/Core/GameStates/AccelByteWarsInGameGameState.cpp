@@ -5,17 +5,25 @@
 
 #include "Core/GameStates/AccelByteWarsInGameGameState.h"
 
+#include "Components/SceneComponent.h"
+#include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
 #include "Net/UnrealNetwork.h"
 
+AAccelByteWarsInGameGameState::AAccelByteWarsInGameGameState()
+{
+	// the countdown timers are set up by the game mode from the game setup, see AAccelByteWarsInGameGameMode::BeginPlay
+	PrimaryActorTick.bCanEverTick = true;
+}
+
 void AAccelByteWarsInGameGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ThisClass, ActiveGameObjects);
-	DOREPLIFETIME(ThisClass, PreGameCountdown);
-	DOREPLIFETIME(ThisClass, PostGameCountdown);
-	DOREPLIFETIME(ThisClass, NotEnoughPlayerCountdown);
-	DOREPLIFETIME(ThisClass, TimeLeft);
+	DOREPLIFETIME(ThisClass, ReplicatedGameObjects);
+	DOREPLIFETIME(ThisClass, PreGameCountdownTimer);
+	DOREPLIFETIME(ThisClass, PostGameCountdownTimer);
+	DOREPLIFETIME(ThisClass, NotEnoughPlayerCountdownTimer);
+	DOREPLIFETIME(ThisClass, TimeLeftTimer);
 	DOREPLIFETIME(ThisClass, GameStatus);
 	DOREPLIFETIME(ThisClass, MinGameBound);
 	DOREPLIFETIME(ThisClass, MaxGameBound);
@@ -24,6 +32,13 @@ void AAccelByteWarsInGameGameState::GetLifetimeReplicatedProps(TArray<FLifetimeP
 	DOREPLIFETIME(ThisClass, GameBoundExtendMultiplier);
 }
 
+void AAccelByteWarsInGameGameState::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	ReplicatedGameObjects.Owner = this;
+}
+
 void AAccelByteWarsInGameGameState::BeginPlay()
 {
 	Super::BeginPlay();
@@ -35,6 +50,38 @@ void AAccelByteWarsInGameGameState::BeginPlay()
 	MinGameBoundExtend = {MinGameBound.X - NewHalfWidth, MinGameBound.Y - NewHalfHeight};
 }
 
+void AAccelByteWarsInGameGameState::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// evaluate the countdowns locally, only the timers replicate
+	const double ServerTime = GetServerWorldTimeSeconds();
+	PostGameCountdown = PostGameCountdownTimer.GetRemaining(ServerTime);
+	NotEnoughPlayerCountdown = NotEnoughPlayerCountdownTimer.GetRemaining(ServerTime);
+	PreGameCountdown = PreGameCountdownTimer.GetRemaining(ServerTime);
+	TimeLeft = TimeLeftTimer.GetRemaining(ServerTime);
+}
+
+float AAccelByteWarsInGameGameState::GetPostGameCountdown() const
+{
+	return PostGameCountdownTimer.GetRemaining(GetServerWorldTimeSeconds());
+}
+
+float AAccelByteWarsInGameGameState::GetNotEnoughPlayerCountdown() const
+{
+	return NotEnoughPlayerCountdownTimer.GetRemaining(GetServerWorldTimeSeconds());
+}
+
+float AAccelByteWarsInGameGameState::GetPreGameCountdown() const
+{
+	return PreGameCountdownTimer.GetRemaining(GetServerWorldTimeSeconds());
+}
+
+float AAccelByteWarsInGameGameState::GetTimeLeft() const
+{
+	return TimeLeftTimer.GetRemaining(GetServerWorldTimeSeconds());
+}
+
 bool AAccelByteWarsInGameGameState::HasGameStarted() const
 {
 	bool bStarted = false;
@@ -68,3 +115,194 @@ bool AAccelByteWarsInGameGameState::HasGameEnded() const
 
 	return bEnded;
 }
+
+void AAccelByteWarsInGameGameState::AddActiveGameObject(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	if (!Component || ActiveGameObjects.Contains(Component))
+	{
+		return;
+	}
+
+	ActiveGameObjects.Add(Component);
+	ReplicatedGameObjects.Add(Component);
+	AddGameObjectPosition(Component);
+	OnActiveGameObjectAdded.Broadcast(Component);
+}
+
+void AAccelByteWarsInGameGameState::RemoveActiveGameObject(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	if (ActiveGameObjects.Remove(Component) == 0)
+	{
+		return;
+	}
+
+	ReplicatedGameObjects.Remove(Component);
+	RemoveGameObjectPosition(Component);
+	OnActiveGameObjectRemoved.Broadcast(Component);
+}
+
+void AAccelByteWarsInGameGameState::OnReplicatedGameObjectAdded(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	if (ActiveGameObjects.Contains(Component))
+	{
+		return;
+	}
+
+	ActiveGameObjects.Add(Component);
+	AddGameObjectPosition(Component);
+	OnActiveGameObjectAdded.Broadcast(Component);
+}
+
+void AAccelByteWarsInGameGameState::OnReplicatedGameObjectRemoved(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	// objects destroyed before the removal arrived are already null
+	ActiveGameObjects.Remove(Component);
+	ActiveGameObjects.Remove(nullptr);
+	RemoveGameObjectPosition(Component);
+	OnActiveGameObjectRemoved.Broadcast(Component);
+}
+
+void AAccelByteWarsInGameGameState::GetGameObjectsNearLocation(
+	const FVector& Location,
+	const float QueryRadius,
+	TArray<UAccelByteWarsGameplayObjectComponent*>& OutObjects)
+{
+	// ships can be moved (e.g. worm hole) and objects added or removed at any time, rebuild once per frame
+	if (GameObjectGridBuildFrame != GFrameCounter)
+	{
+		GameObjectGrid.Rebuild(ActiveGameObjects, MinGameBoundExtend, MaxGameBoundExtend, GameObjectGridCellSize);
+		GameObjectGridBuildFrame = GFrameCounter;
+	}
+
+	GameObjectGrid.Query(Location, QueryRadius, OutObjects);
+}
+
+bool AAccelByteWarsInGameGameState::SampleStaticGravityField(const FVector& Location, FVector& OutField)
+{
+	RefreshGravityBodies();
+	return GravityField.Sample(Location, OutField);
+}
+
+const TArray<UAccelByteWarsGameplayObjectComponent*>& AAccelByteWarsInGameGameState::GetDynamicGravityBodies()
+{
+	RefreshGravityBodies();
+	return DynamicGravityBodies;
+}
+
+void AAccelByteWarsInGameGameState::RegisterLiveMissile(AAccelByteWarsMissile* Missile, const int32 TeamId)
+{
+	if (!Missile)
+	{
+		return;
+	}
+
+	UnregisterLiveMissile(Missile);
+	LiveMissilesByTeam.FindOrAdd(TeamId).Add(Missile);
+}
+
+void AAccelByteWarsInGameGameState::UnregisterLiveMissile(AAccelByteWarsMissile* Missile)
+{
+	// only a handful of teams
+	for (TPair<int32, TArray<AAccelByteWarsMissile*>>& Team : LiveMissilesByTeam)
+	{
+		if (Team.Value.RemoveSingleSwap(Missile, false) > 0)
+		{
+			return;
+		}
+	}
+}
+
+void AAccelByteWarsInGameGameState::RefreshGravityBodies()
+{
+	if (GravityBodiesRefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+	GravityBodiesRefreshFrame = GFrameCounter;
+
+	// cheap hash over the static bodies, the field itself is only recomputed when planets are spawned or reset
+	const uint32 Signature = FAccelByteWarsGravityField::CalculateSignature(
+		ActiveGameObjects, MinGameBoundExtend, MaxGameBoundExtend, GravityFieldCellSize);
+	if (GravityField.IsEmpty() || GravityField.GetSignature() != Signature)
+	{
+		GravityField.Rebuild(ActiveGameObjects, MinGameBoundExtend, MaxGameBoundExtend, GravityFieldCellSize);
+	}
+
+	DynamicGravityBodies.Reset();
+	for (UAccelByteWarsGameplayObjectComponent* Object : ActiveGameObjects)
+	{
+		if (Object && Object->GetOwner() && !FAccelByteWarsGravityField::IsStaticBody(Object))
+		{
+			DynamicGravityBodies.Add(Object);
+		}
+	}
+}
+
+void AAccelByteWarsInGameGameState::AddGameObjectPosition(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	if (!Component || !Component->GetOwner())
+	{
+		return;
+	}
+
+	if (Component->ObjectType == EGameplayObjectType::SHIP)
+	{
+		ShipObjects.Add(Component);
+		ShipPositions.Add(GetGameObjectPosition(Component));
+
+		// refreshed when the ship moves, flying or teleported, instead of when its position is read
+		if (USceneComponent* ShipRoot = Component->GetOwner()->GetRootComponent())
+		{
+			ShipRoot->TransformUpdated.AddUObject(this, &ThisClass::OnShipTransformUpdated);
+		}
+	}
+	else
+	{
+		StaticBodies.Add(Component);
+		StaticBodyPositions.Add(GetGameObjectPosition(Component));
+	}
+}
+
+void AAccelByteWarsInGameGameState::RemoveGameObjectPosition(const UAccelByteWarsGameplayObjectComponent* Component)
+{
+	if (Component && Component->GetOwner() && Component->GetOwner()->GetRootComponent())
+	{
+		Component->GetOwner()->GetRootComponent()->TransformUpdated.RemoveAll(this);
+	}
+
+	// objects destroyed before the removal arrived are already null, the slack is kept for the next spawn
+	const auto RemoveFrom = [Component](TArray<UAccelByteWarsGameplayObjectComponent*>& Objects, TArray<FVector>& Positions)
+	{
+		for (int32 i = Objects.Num() - 1; i >= 0; --i)
+		{
+			if (Objects[i] == Component || Objects[i] == nullptr)
+			{
+				Objects.RemoveAtSwap(i, 1, false);
+				Positions.RemoveAtSwap(i, 1, false);
+			}
+		}
+	};
+	RemoveFrom(ShipObjects, ShipPositions);
+	RemoveFrom(StaticBodies, StaticBodyPositions);
+}
+
+void AAccelByteWarsInGameGameState::OnShipTransformUpdated(
+	USceneComponent* UpdatedComponent,
+	EUpdateTransformFlags UpdateTransformFlags,
+	ETeleportType Teleport)
+{
+	for (int32 i = 0; i < ShipObjects.Num(); ++i)
+	{
+		if (ShipObjects[i] && ShipObjects[i]->GetOwner() && ShipObjects[i]->GetOwner()->GetRootComponent() == UpdatedComponent)
+		{
+			ShipPositions[i] = GetGameObjectPosition(ShipObjects[i]);
+			return;
+		}
+	}
+}
+
+FVector AAccelByteWarsInGameGameState::GetGameObjectPosition(const UAccelByteWarsGameplayObjectComponent* Component)
+{
+	const FVector& ActorLocation = Component->GetOwner()->GetActorLocation();
+	return FVector(ActorLocation.X, ActorLocation.Y, Component->Radius * 100.0f);
+}
@@ -6,9 +6,14 @@
 
 #include "CoreMinimal.h"
 #include "AccelByteWarsGameState.h"
+#include "Core/GameStates/AccelByteWarsCountdown.h"
+#include "Core/GameStates/AccelByteWarsGameObjectGrid.h"
+#include "Core/GameStates/AccelByteWarsGravityField.h"
+#include "Core/GameStates/AccelByteWarsReplicatedGameObjects.h"
 #include "AccelByteWarsInGameGameState.generated.h"
 
 class UAccelByteWarsGameplayObjectComponent;
+class AAccelByteWarsMissile;
 
 #pragma region "Structs, Enums, and Delegates declaration"
 UENUM(BlueprintType)
@@ -23,6 +28,8 @@ enum class EGameStatus : uint8
 	GAME_ENDS,
 	INVALID
 };
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnActiveGameObjectChanged, UAccelByteWarsGameplayObjectComponent*, Component);
 #pragma endregion 
 
 UCLASS()
@@ -31,9 +38,13 @@ class ACCELBYTEWARS_API AAccelByteWarsInGameGameState : public AAccelByteWarsGam
 	GENERATED_BODY()
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PostInitializeComponents() override;
 	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
 
 public:
+	AAccelByteWarsInGameGameState();
+
 	UFUNCTION(BlueprintCallable)
 	bool HasGameStarted() const;
 
@@ -46,22 +57,54 @@ public:
 	UPROPERTY(BlueprintReadWrite, Replicated)
 	EGameStatus GameStatus = EGameStatus::IDLE;
 
+	/*
+	 * The countdown values below are evaluated locally every frame from their timer, they do not replicate and
+	 * writing them has no effect. The server drives the timers, see FAccelByteWarsCountdown.
+	 */
+
 	// Countdown when the game is over
-	UPROPERTY(Replicated)
+	UPROPERTY(BlueprintReadOnly)
 	float PostGameCountdown = INDEX_NONE;
 
-	UPROPERTY(Replicated)
+	UPROPERTY(BlueprintReadOnly)
 	float NotEnoughPlayerCountdown = INDEX_NONE;
 
 	/**
-	 * @brief Pre-game (already in gameplay map) countdown duration
+	 * @brief Pre-game (already in gameplay map) countdown, its timer starts from this value
 	 */
-	UPROPERTY(BlueprintReadWrite, Replicated)
+	UPROPERTY(BlueprintReadOnly)
 	float PreGameCountdown = 5.0f;
 
-	UPROPERTY(BlueprintReadWrite, Replicated)
+	UPROPERTY(BlueprintReadOnly)
 	float TimeLeft = INDEX_NONE;
 
+	UPROPERTY(Replicated)
+	FAccelByteWarsCountdown PostGameCountdownTimer;
+
+	UPROPERTY(Replicated)
+	FAccelByteWarsCountdown NotEnoughPlayerCountdownTimer;
+
+	UPROPERTY(Replicated)
+	FAccelByteWarsCountdown PreGameCountdownTimer;
+
+	UPROPERTY(Replicated)
+	FAccelByteWarsCountdown TimeLeftTimer;
+
+	/**
+	 * @brief Remaining seconds of the countdowns at the current server time, up to date mid-frame unlike the values above
+	 */
+	UFUNCTION(BlueprintPure)
+	float GetPostGameCountdown() const;
+
+	UFUNCTION(BlueprintPure)
+	float GetNotEnoughPlayerCountdown() const;
+
+	UFUNCTION(BlueprintPure)
+	float GetPreGameCountdown() const;
+
+	UFUNCTION(BlueprintPure)
+	float GetTimeLeft() const;
+
 	UPROPERTY(BlueprintReadWrite, Replicated)
 	FVector2D MinGameBound = {-2500.0, -1400.0};
 
@@ -80,13 +123,167 @@ public:
 	UPROPERTY(BlueprintReadWrite, Replicated)
 	FVector2D MaxStarsGameBound = {1500.0, 1300.0};
 
-	UPROPERTY(Replicated, BlueprintReadWrite)
+	/**
+	 * @brief Gameplay objects in play. Replicated through ReplicatedGameObjects, modify it with AddActiveGameObject and RemoveActiveGameObject.
+	 */
+	UPROPERTY(BlueprintReadOnly)
 	TArray<UAccelByteWarsGameplayObjectComponent*> ActiveGameObjects;
 
+	/**
+	 * @brief Server only. Add to ActiveGameObjects and replicate the addition.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly)
+	void AddActiveGameObject(UAccelByteWarsGameplayObjectComponent* Component);
+
+	/**
+	 * @brief Server only. Remove from ActiveGameObjects and replicate the removal.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly)
+	void RemoveActiveGameObject(UAccelByteWarsGameplayObjectComponent* Component);
+
+	/**
+	 * @brief Called on server and clients when an object enters ActiveGameObjects
+	 */
+	UPROPERTY(BlueprintAssignable)
+	FOnActiveGameObjectChanged OnActiveGameObjectAdded;
+
+	/**
+	 * @brief Called on server and clients when an object leaves ActiveGameObjects. Component is null if already destroyed.
+	 */
+	UPROPERTY(BlueprintAssignable)
+	FOnActiveGameObjectChanged OnActiveGameObjectRemoved;
+
+	void OnReplicatedGameObjectAdded(UAccelByteWarsGameplayObjectComponent* Component);
+	void OnReplicatedGameObjectRemoved(UAccelByteWarsGameplayObjectComponent* Component);
+
+	/**
+	 * @brief Cell size of the spatial grid used for gameplay object proximity queries
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GameObjectGridCellSize = 500.0f;
+
+	/**
+	 * @brief Get ActiveGameObjects whose surface may be within QueryRadius of Location. Broadphase only, caller does the exact test.
+	 * @param Location Query center
+	 * @param QueryRadius Max distance from Location to the objects' surface
+	 * @param OutObjects Output: candidate objects
+	 */
+	void GetGameObjectsNearLocation(
+		const FVector& Location,
+		const float QueryRadius,
+		TArray<UAccelByteWarsGameplayObjectComponent*>& OutObjects);
+
+	/**
+	 * @brief Distance between two samples of the static gravity field
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float GravityFieldCellSize = 25.0f;
+
+	/**
+	 * @brief Sample the precomputed gravity of planets and stars, see FAccelByteWarsGravityField
+	 * @param Location Sample location
+	 * @param OutField Output: force per (GravitationalConstant * Mass) at Location
+	 * @return false if Location is outside of the field
+	 */
+	bool SampleStaticGravityField(const FVector& Location, FVector& OutField);
+
+	/**
+	 * @brief ActiveGameObjects that are not part of the static gravity field (ships)
+	 */
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& GetDynamicGravityBodies();
+
+	/**
+	 * @brief ActiveGameObjects of type SHIP, up to date as soon as an object is added or removed
+	 */
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& GetShipObjects() const { return ShipObjects; }
+
+	/**
+	 * @brief X, Y location and Z radius, in unreal unit, of each of GetShipObjects. Refreshed whenever a ship moves.
+	 */
+	const TArray<FVector>& GetShipPositions() const { return ShipPositions; }
+
+	/**
+	 * @brief ActiveGameObjects that are planets or stars, up to date as soon as an object is added or removed
+	 */
+	const TArray<UAccelByteWarsGameplayObjectComponent*>& GetStaticBodies() const { return StaticBodies; }
+
+	/**
+	 * @brief X, Y location and Z radius, in unreal unit, of each of GetStaticBodies. Static bodies never move.
+	 */
+	const TArray<FVector>& GetStaticBodyPositions() const { return StaticBodyPositions; }
+
+	/**
+	 * @brief Track a flying missile under the team of its owner. Registering again moves the missile to TeamId.
+	 * @param Missile Missile that just got activated
+	 * @param TeamId Team of the missile's owner, INDEX_NONE if unknown
+	 */
+	void RegisterLiveMissile(AAccelByteWarsMissile* Missile, const int32 TeamId);
+
+	/**
+	 * @brief Stop tracking a missile that got released to the pool or destroyed
+	 */
+	void UnregisterLiveMissile(AAccelByteWarsMissile* Missile);
+
+	/**
+	 * @brief Flying missiles per owner team, INDEX_NONE holds the ones whose owner had no team when they were fired.
+	 * Destroying a missile unregisters it, copy the list before doing so.
+	 */
+	const TMap<int32, TArray<AAccelByteWarsMissile*>>& GetLiveMissilesByTeam() const { return LiveMissilesByTeam; }
+
 protected:
 	/**
 	 * @brief The maximum "play area". In which object can still exist. If exceeds, object needs to destroy itself.
 	 */
 	UPROPERTY(BlueprintReadWrite, Replicated)
 	float GameBoundExtendMultiplier = 1.5f;
+
+private:
+	UPROPERTY(Replicated)
+	FAccelByteWarsReplicatedGameObjects ReplicatedGameObjects;
+
+	/**
+	 * @brief Broadphase over ActiveGameObjects, rebuilt lazily at most once per frame
+	 */
+	FAccelByteWarsGameObjectGrid GameObjectGrid;
+
+	uint64 GameObjectGridBuildFrame = MAX_uint64;
+
+	void RefreshGravityBodies();
+
+	/**
+	 * @brief Gravity of planets and stars, rebuilt only when the set of static bodies or the bound changes
+	 */
+	FAccelByteWarsGravityField GravityField;
+
+	TArray<UAccelByteWarsGameplayObjectComponent*> DynamicGravityBodies;
+
+	uint64 GravityBodiesRefreshFrame = MAX_uint64;
+
+	/**
+	 * @brief Position snapshot of ActiveGameObjects, grown on spawn and shrunk on removal only
+	 */
+	void AddGameObjectPosition(UAccelByteWarsGameplayObjectComponent* Component);
+	void RemoveGameObjectPosition(const UAccelByteWarsGameplayObjectComponent* Component);
+	static FVector GetGameObjectPosition(const UAccelByteWarsGameplayObjectComponent* Component);
+
+	/**
+	 * @brief Bound to the root component of every ship in ShipObjects
+	 */
+	void OnShipTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	// UPROPERTY so that destroyed objects show up as null until their removal replicates
+	UPROPERTY()
+	TArray<UAccelByteWarsGameplayObjectComponent*> ShipObjects;
+
+	TArray<FVector> ShipPositions;
+
+	UPROPERTY()
+	TArray<UAccelByteWarsGameplayObjectComponent*> StaticBodies;
+
+	TArray<FVector> StaticBodyPositions;
+
+	/**
+	 * @brief Missiles unregister themselves on release and on EndPlay, entries are never stale
+	 */
+	TMap<int32, TArray<AAccelByteWarsMissile*>> LiveMissilesByTeam;
 };
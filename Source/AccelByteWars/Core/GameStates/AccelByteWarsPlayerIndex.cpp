@@ -0,0 +1,74 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameStates/AccelByteWarsPlayerIndex.h"
+
+FGameplayPlayerData* FAccelByteWarsPlayerIndex::Find(TArray<FGameplayTeamData>& Teams, const FUniqueNetIdRepl& UniqueNetId, const int32 ControllerId)
+{
+	if (bDirty)
+	{
+		Rebuild(Teams);
+	}
+
+	// same matching rule as FGameplayPlayerData::operator==, with the stored player on the left hand side
+	const FGameplayPlayerData Key{UniqueNetId, ControllerId};
+
+	// a second try after a rebuild if the first slot was stale
+	for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+	{
+		const FIntPoint* Slot = UniqueNetId.IsValid() ? IndexByUniqueNetId.Find(UniqueNetId) : nullptr;
+		if (!Slot)
+		{
+			Slot = IndexByControllerId.Find(ControllerId);
+		}
+
+		// unknown or departed players, common during login and logout
+		if (!Slot)
+		{
+			return nullptr;
+		}
+
+		if (Teams.IsValidIndex(Slot->X)
+			&& Teams[Slot->X].TeamMembers.IsValidIndex(Slot->Y)
+			&& Teams[Slot->X].TeamMembers[Slot->Y] == Key)
+		{
+			return &Teams[Slot->X].TeamMembers[Slot->Y];
+		}
+
+		// Teams changed without MarkDirty, never return somebody else's data and re-index right away
+		Rebuild(Teams);
+	}
+
+	return nullptr;
+}
+
+void FAccelByteWarsPlayerIndex::Rebuild(const TArray<FGameplayTeamData>& Teams)
+{
+	IndexByUniqueNetId.Reset();
+	IndexByControllerId.Reset();
+
+	for (int32 TeamIndex = 0; TeamIndex < Teams.Num(); ++TeamIndex)
+	{
+		const TArray<FGameplayPlayerData>& TeamMembers = Teams[TeamIndex].TeamMembers;
+		for (int32 MemberIndex = 0; MemberIndex < TeamMembers.Num(); ++MemberIndex)
+		{
+			const FGameplayPlayerData& PlayerData = TeamMembers[MemberIndex];
+
+			// first occurrence wins, like a linear search
+			if (PlayerData.UniqueNetId.IsValid())
+			{
+				if (!IndexByUniqueNetId.Contains(PlayerData.UniqueNetId))
+				{
+					IndexByUniqueNetId.Add(PlayerData.UniqueNetId, FIntPoint(TeamIndex, MemberIndex));
+				}
+			}
+			else if (!IndexByControllerId.Contains(PlayerData.ControllerId))
+			{
+				IndexByControllerId.Add(PlayerData.ControllerId, FIntPoint(TeamIndex, MemberIndex));
+			}
+		}
+	}
+
+	bDirty = false;
+}
@@ -0,0 +1,45 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/System/AccelByteWarsGameInstance.h"
+
+/**
+ * @brief Team index (X) and member index (Y) in a Teams array of every player, keyed by unique net id or controller id.
+ * Rebuilt on the first lookup after MarkDirty or when a lookup finds a stale slot, a lookup costs a map find otherwise.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsPlayerIndex
+{
+public:
+	/**
+	 * @brief Player data in Teams, same matching rule as FGameplayPlayerData::operator==
+	 * @param Teams Teams the index was built from, rebuilt from it first if dirty
+	 * @param UniqueNetId Target player's unique net id
+	 * @param ControllerId Target player's controller id, only used if the unique net id is not valid
+	 * @return nullptr if not found
+	 */
+	FGameplayPlayerData* Find(TArray<FGameplayTeamData>& Teams, const FUniqueNetIdRepl& UniqueNetId, const int32 ControllerId);
+
+	/**
+	 * @brief Rebuild on next lookup. Call after adding, removing or moving members of Teams.
+	 */
+	void MarkDirty() { bDirty = true; }
+
+private:
+	void Rebuild(const TArray<FGameplayTeamData>& Teams);
+
+	/**
+	 * @brief Players with a valid unique net id
+	 */
+	TMap<FUniqueNetIdRepl, FIntPoint> IndexByUniqueNetId;
+
+	/**
+	 * @brief Local players without unique net id
+	 */
+	TMap<int32, FIntPoint> IndexByControllerId;
+
+	bool bDirty = true;
+};
@@ -0,0 +1,50 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameStates/AccelByteWarsReplicatedGameObjects.h"
+
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+
+void FAccelByteWarsReplicatedGameObject::PostReplicatedAdd(const FAccelByteWarsReplicatedGameObjects& InArraySerializer)
+{
+	// Component is null until its actor is replicated, PostReplicatedChange follows once it is mapped
+	if (Component && InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedGameObjectAdded(Component);
+	}
+}
+
+void FAccelByteWarsReplicatedGameObject::PostReplicatedChange(const FAccelByteWarsReplicatedGameObjects& InArraySerializer)
+{
+	PostReplicatedAdd(InArraySerializer);
+}
+
+void FAccelByteWarsReplicatedGameObject::PreReplicatedRemove(const FAccelByteWarsReplicatedGameObjects& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnReplicatedGameObjectRemoved(Component);
+	}
+}
+
+void FAccelByteWarsReplicatedGameObjects::Add(UAccelByteWarsGameplayObjectComponent* Component)
+{
+	FAccelByteWarsReplicatedGameObject& Item = Items.AddDefaulted_GetRef();
+	Item.Component = Component;
+	MarkItemDirty(Item);
+}
+
+void FAccelByteWarsReplicatedGameObjects::Remove(const UAccelByteWarsGameplayObjectComponent* Component)
+{
+	const int32 Index = Items.IndexOfByPredicate([Component](const FAccelByteWarsReplicatedGameObject& Item)
+	{
+		return Item.Component == Component;
+	});
+
+	if (Index != INDEX_NONE)
+	{
+		Items.RemoveAtSwap(Index);
+		MarkArrayDirty();
+	}
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "AccelByteWarsReplicatedGameObjects.generated.h"
+
+class AAccelByteWarsInGameGameState;
+class UAccelByteWarsGameplayObjectComponent;
+struct FAccelByteWarsReplicatedGameObjects;
+
+USTRUCT()
+struct FAccelByteWarsReplicatedGameObject : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UAccelByteWarsGameplayObjectComponent* Component = nullptr;
+
+	void PostReplicatedAdd(const FAccelByteWarsReplicatedGameObjects& InArraySerializer);
+	void PostReplicatedChange(const FAccelByteWarsReplicatedGameObjects& InArraySerializer);
+	void PreReplicatedRemove(const FAccelByteWarsReplicatedGameObjects& InArraySerializer);
+};
+
+/**
+ * Delta replicated copy of AAccelByteWarsInGameGameState::ActiveGameObjects.
+ * Adding or removing an object only sends that object, clients are notified per object.
+ */
+USTRUCT()
+struct FAccelByteWarsReplicatedGameObjects : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FAccelByteWarsReplicatedGameObject> Items;
+
+	/**
+	 * @brief Game state notified when items are received, not replicated
+	 */
+	AAccelByteWarsInGameGameState* Owner = nullptr;
+
+	void Add(UAccelByteWarsGameplayObjectComponent* Component);
+	void Remove(const UAccelByteWarsGameplayObjectComponent* Component);
+
+	//~FFastArraySerializer contract
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FAccelByteWarsReplicatedGameObject, FAccelByteWarsReplicatedGameObjects>(Items, DeltaParms, *this);
+	}
+	//~End of FFastArraySerializer contract
+};
+
+template<>
+struct TStructOpsTypeTraits<FAccelByteWarsReplicatedGameObjects> : public TStructOpsTypeTraitsBase2<FAccelByteWarsReplicatedGameObjects>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
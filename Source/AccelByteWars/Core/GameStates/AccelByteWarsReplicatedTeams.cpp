@@ -0,0 +1,209 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameStates/AccelByteWarsReplicatedTeams.h"
+
+#include "Core/GameStates/AccelByteWarsGameState.h"
+
+FAccelByteWarsReplicatedTeamSlotKey::FAccelByteWarsReplicatedTeamSlotKey(const FAccelByteWarsReplicatedTeamSlot& Slot)
+	: TeamId(Slot.TeamId)
+{
+	if (!Slot.IsTeam())
+	{
+		*this = FAccelByteWarsReplicatedTeamSlotKey(Slot.TeamId, Slot.PlayerData);
+	}
+}
+
+FAccelByteWarsReplicatedTeamSlotKey::FAccelByteWarsReplicatedTeamSlotKey(const int32 InTeamId, const FGameplayPlayerData& PlayerData)
+	: TeamId(InTeamId)
+	, bIsTeam(false)
+{
+	// Same fallback as FAccelByteWarsPlayerIndex, local players have no unique net id
+	if (PlayerData.UniqueNetId.IsValid())
+	{
+		UniqueNetId = PlayerData.UniqueNetId;
+	}
+	else
+	{
+		ControllerId = PlayerData.ControllerId;
+	}
+}
+
+bool FAccelByteWarsReplicatedTeamSlot::IsIdentical(const FAccelByteWarsReplicatedTeamSlot& Other) const
+{
+	// FGameplayPlayerData::operator== only compares ids
+	return TeamIndex == Other.TeamIndex
+		&& TeamId == Other.TeamId
+		&& MemberIndex == Other.MemberIndex
+		&& FGameplayPlayerData::StaticStruct()->CompareScriptStruct(&PlayerData, &Other.PlayerData, PPF_None);
+}
+
+void FAccelByteWarsReplicatedTeamSlot::PostReplicatedAdd(const FAccelByteWarsReplicatedTeams& InArraySerializer)
+{
+	InArraySerializer.bReceivedChange = true;
+	if (!IsTeam())
+	{
+		InArraySerializer.ReceivedMembers.Add(PlayerData);
+	}
+}
+
+void FAccelByteWarsReplicatedTeamSlot::PostReplicatedChange(const FAccelByteWarsReplicatedTeams& InArraySerializer)
+{
+	PostReplicatedAdd(InArraySerializer);
+}
+
+void FAccelByteWarsReplicatedTeamSlot::PreReplicatedRemove(const FAccelByteWarsReplicatedTeams& InArraySerializer)
+{
+	PostReplicatedAdd(InArraySerializer);
+}
+
+void FAccelByteWarsReplicatedTeams::SyncFromTeams(const TArray<FGameplayTeamData>& Teams)
+{
+	// Slots are matched by team and player, not by position, so a player leaving or moving only touches their own slots
+	RebuildSlotIndices();
+
+	TBitArray<> SyncedSlots(false, Slots.Num());
+	for (int32 TeamIndex = 0; TeamIndex < Teams.Num(); ++TeamIndex)
+	{
+		const FGameplayTeamData& Team = Teams[TeamIndex];
+
+		FAccelByteWarsReplicatedTeamSlot TeamSlot;
+		TeamSlot.TeamIndex = TeamIndex;
+		TeamSlot.TeamId = Team.TeamId;
+		SyncSlot(SyncedSlots, TeamSlot);
+
+		for (int32 MemberIndex = 0; MemberIndex < Team.TeamMembers.Num(); ++MemberIndex)
+		{
+			FAccelByteWarsReplicatedTeamSlot MemberSlot;
+			MemberSlot.TeamIndex = TeamIndex;
+			MemberSlot.TeamId = Team.TeamId;
+			MemberSlot.MemberIndex = MemberIndex;
+			MemberSlot.PlayerData = Team.TeamMembers[MemberIndex];
+			SyncSlot(SyncedSlots, MemberSlot);
+		}
+	}
+
+	// Slots of teams and players that are gone, backwards so that the indices still to visit stay valid
+	bool bRemovedSlot = false;
+	for (int32 SlotIndex = SyncedSlots.Num() - 1; SlotIndex >= 0; --SlotIndex)
+	{
+		if (!SyncedSlots[SlotIndex])
+		{
+			Slots.RemoveAtSwap(SlotIndex, 1, false);
+			bRemovedSlot = true;
+		}
+	}
+
+	if (bRemovedSlot)
+	{
+		MarkArrayDirty();
+	}
+
+	// For SyncMember, slots were added and moved
+	RebuildSlotIndices();
+}
+
+bool FAccelByteWarsReplicatedTeams::SyncMember(const FGameplayPlayerData& PlayerData)
+{
+	const int32* SlotIndex = SlotIndices.Find(FAccelByteWarsReplicatedTeamSlotKey(PlayerData.TeamId, PlayerData));
+	if (SlotIndex == nullptr || !Slots.IsValidIndex(*SlotIndex))
+	{
+		return false;
+	}
+
+	// Only the player's fields, where they are in Teams is left to SyncFromTeams
+	FAccelByteWarsReplicatedTeamSlot& Slot = Slots[*SlotIndex];
+	if (!FGameplayPlayerData::StaticStruct()->CompareScriptStruct(&Slot.PlayerData, &PlayerData, PPF_None))
+	{
+		Slot.PlayerData = PlayerData;
+		MarkItemDirty(Slot);
+	}
+	return true;
+}
+
+void FAccelByteWarsReplicatedTeams::RebuildSlotIndices()
+{
+	SlotIndices.Reset();
+	SlotIndices.Reserve(Slots.Num());
+	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	{
+		const FAccelByteWarsReplicatedTeamSlotKey Key(Slots[SlotIndex]);
+		if (!SlotIndices.Contains(Key))
+		{
+			SlotIndices.Add(Key, SlotIndex);
+		}
+	}
+}
+
+void FAccelByteWarsReplicatedTeams::SyncSlot(TBitArray<>& SyncedSlots, const FAccelByteWarsReplicatedTeamSlot& NewSlot)
+{
+	// A key seen twice in Teams gets a slot of its own instead of overwriting the first one
+	const int32* SlotIndex = SlotIndices.Find(FAccelByteWarsReplicatedTeamSlotKey(NewSlot));
+	if (SlotIndex == nullptr || SyncedSlots[*SlotIndex])
+	{
+		MarkItemDirty(Slots.Add_GetRef(NewSlot));
+		return;
+	}
+
+	SyncedSlots[*SlotIndex] = true;
+
+	FAccelByteWarsReplicatedTeamSlot& Slot = Slots[*SlotIndex];
+	if (Slot.IsIdentical(NewSlot))
+	{
+		return;
+	}
+
+	// Field by field, the replication id and key of the slot must be kept
+	Slot.TeamIndex = NewSlot.TeamIndex;
+	Slot.TeamId = NewSlot.TeamId;
+	Slot.MemberIndex = NewSlot.MemberIndex;
+	Slot.PlayerData = NewSlot.PlayerData;
+	MarkItemDirty(Slot);
+}
+
+void FAccelByteWarsReplicatedTeams::BuildTeams(TArray<FGameplayTeamData>& OutTeams) const
+{
+	// Received slots are not in server order, their indices are
+	OutTeams.Reset();
+	for (const FAccelByteWarsReplicatedTeamSlot& Slot : Slots)
+	{
+		if (Slot.TeamIndex <= INDEX_NONE)
+		{
+			continue;
+		}
+
+		if (OutTeams.Num() <= Slot.TeamIndex)
+		{
+			OutTeams.SetNum(Slot.TeamIndex + 1);
+		}
+
+		FGameplayTeamData& Team = OutTeams[Slot.TeamIndex];
+		Team.TeamId = Slot.TeamId;
+
+		if (!Slot.IsTeam())
+		{
+			if (Team.TeamMembers.Num() <= Slot.MemberIndex)
+			{
+				Team.TeamMembers.SetNum(Slot.MemberIndex + 1);
+			}
+			Team.TeamMembers[Slot.MemberIndex] = Slot.PlayerData;
+		}
+	}
+}
+
+void FAccelByteWarsReplicatedTeams::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (!bReceivedChange)
+	{
+		return;
+	}
+
+	if (Owner)
+	{
+		Owner->OnReplicatedTeamsReceived(ReceivedMembers);
+	}
+
+	ReceivedMembers.Reset();
+	bReceivedChange = false;
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/System/AccelByteWarsGameInstance.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "AccelByteWarsReplicatedTeams.generated.h"
+
+class AAccelByteWarsGameState;
+struct FAccelByteWarsReplicatedTeams;
+
+/**
+ * @brief One slot of the flattened Teams array, either a team (MemberIndex is INDEX_NONE) or one of its members
+ */
+USTRUCT()
+struct FAccelByteWarsReplicatedTeamSlot : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 TeamIndex = INDEX_NONE;
+
+	UPROPERTY()
+	int32 TeamId = INDEX_NONE;
+
+	UPROPERTY()
+	int32 MemberIndex = INDEX_NONE;
+
+	UPROPERTY()
+	FGameplayPlayerData PlayerData;
+
+	bool IsTeam() const { return MemberIndex == INDEX_NONE; }
+
+	bool IsIdentical(const FAccelByteWarsReplicatedTeamSlot& Other) const;
+
+	void PostReplicatedAdd(const FAccelByteWarsReplicatedTeams& InArraySerializer);
+	void PostReplicatedChange(const FAccelByteWarsReplicatedTeams& InArraySerializer);
+	void PreReplicatedRemove(const FAccelByteWarsReplicatedTeams& InArraySerializer);
+};
+
+/**
+ * @brief Identity of a slot across syncs: its team, and for a member its unique net id, or controller id for local players
+ */
+struct FAccelByteWarsReplicatedTeamSlotKey
+{
+	explicit FAccelByteWarsReplicatedTeamSlotKey(const FAccelByteWarsReplicatedTeamSlot& Slot);
+
+	/**
+	 * @brief Key of the slot of a member of the team with InTeamId
+	 */
+	FAccelByteWarsReplicatedTeamSlotKey(const int32 InTeamId, const FGameplayPlayerData& PlayerData);
+
+	int32 TeamId = INDEX_NONE;
+	bool bIsTeam = true;
+	FUniqueNetIdRepl UniqueNetId;
+	int32 ControllerId = INDEX_NONE;
+
+	bool operator==(const FAccelByteWarsReplicatedTeamSlotKey& Other) const
+	{
+		return TeamId == Other.TeamId && bIsTeam == Other.bIsTeam && UniqueNetId == Other.UniqueNetId && ControllerId == Other.ControllerId;
+	}
+
+	friend uint32 GetTypeHash(const FAccelByteWarsReplicatedTeamSlotKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.TeamId), GetTypeHash(Key.bIsTeam)), HashCombine(GetTypeHash(Key.UniqueNetId), GetTypeHash(Key.ControllerId)));
+	}
+};
+
+/**
+ * Delta replicated copy of AAccelByteWarsGameState::Teams.
+ * A change to a single player, e.g. a score, kill or life change, is copied to that player's slot with SyncMember.
+ * After teams or players were added, removed or moved, the server diffs Teams against the slots with SyncFromTeams
+ * and only marks the slots that changed dirty. Slots are matched by FAccelByteWarsReplicatedTeamSlotKey, so a player
+ * leaving removes their slot and only shifts the member index of their teammates after them.
+ * Clients rebuild Teams from the slots.
+ */
+USTRUCT()
+struct FAccelByteWarsReplicatedTeams : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FAccelByteWarsReplicatedTeamSlot> Slots;
+
+	/**
+	 * @brief Game state notified when replicated slots are received, not replicated
+	 */
+	AAccelByteWarsGameState* Owner = nullptr;
+
+	/**
+	 * @brief Server: update the slots from Teams, marking changed slots dirty
+	 */
+	void SyncFromTeams(const TArray<FGameplayTeamData>& Teams);
+
+	/**
+	 * @brief Server: update the slot of a player whose fields changed in place, marking it dirty if it changed
+	 * @param PlayerData Member of the Teams the slots were last synced from
+	 * @return false if the player has no slot yet, SyncFromTeams is needed
+	 */
+	bool SyncMember(const FGameplayPlayerData& PlayerData);
+
+	/**
+	 * @brief Client: rebuild the Teams array the slots were synced from
+	 */
+	void BuildTeams(TArray<FGameplayTeamData>& OutTeams) const;
+
+	//~FFastArraySerializer contract
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FAccelByteWarsReplicatedTeamSlot, FAccelByteWarsReplicatedTeams>(Slots, DeltaParms, *this);
+	}
+	//~End of FFastArraySerializer contract
+
+private:
+	friend struct FAccelByteWarsReplicatedTeamSlot;
+
+	/**
+	 * @brief Update the slot with the key of NewSlot, or add it, and flag it in SyncedSlots
+	 */
+	void SyncSlot(TBitArray<>& SyncedSlots, const FAccelByteWarsReplicatedTeamSlot& NewSlot);
+
+	/**
+	 * @brief Index SlotIndices from Slots, the first slot of a key wins
+	 */
+	void RebuildSlotIndices();
+
+	// Server only, index of every slot by key as of the last SyncFromTeams
+	TMap<FAccelByteWarsReplicatedTeamSlotKey, int32> SlotIndices;
+
+	// Filled by the slot callbacks of a single receive, which only get a const serializer
+	mutable TArray<FGameplayPlayerData> ReceivedMembers;
+	mutable bool bReceivedChange = false;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAccelByteWarsReplicatedTeams> : public TStructOpsTypeTraitsBase2<FAccelByteWarsReplicatedTeams>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -0,0 +1,62 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/GameStates/AccelByteWarsTeamTotals.h"
+
+const FAccelByteWarsTeamTotals* FAccelByteWarsTeamTotalsCache::Find(const TArray<FGameplayTeamData>& Teams, const int32 TeamId)
+{
+	if (bDirty || Totals.Num() != Teams.Num())
+	{
+		Totals.Reset();
+		for (const FGameplayTeamData& Team : Teams)
+		{
+			FAccelByteWarsTeamTotals& TeamTotals = Totals.Add(Team.TeamId);
+			TeamTotals.Score = Team.GetTeamScore();
+			TeamTotals.LivesLeft = Team.GetTeamLivesLeft();
+			TeamTotals.KillCount = Team.GetTeamKillCount();
+		}
+		bDirty = false;
+	}
+
+	return Totals.Find(TeamId);
+}
+
+void FAccelByteWarsTeamTotalsCache::SetPlayerScore(FGameplayPlayerData& PlayerData, const float Score)
+{
+	if (FAccelByteWarsTeamTotals* TeamTotals = bDirty ? nullptr : Totals.Find(PlayerData.TeamId))
+	{
+		TeamTotals->Score += Score - PlayerData.Score;
+	}
+	else
+	{
+		bDirty = true;
+	}
+	PlayerData.Score = Score;
+}
+
+void FAccelByteWarsTeamTotalsCache::SetPlayerKillCount(FGameplayPlayerData& PlayerData, const int32 KillCount)
+{
+	if (FAccelByteWarsTeamTotals* TeamTotals = bDirty ? nullptr : Totals.Find(PlayerData.TeamId))
+	{
+		TeamTotals->KillCount += KillCount - PlayerData.KillCount;
+	}
+	else
+	{
+		bDirty = true;
+	}
+	PlayerData.KillCount = KillCount;
+}
+
+void FAccelByteWarsTeamTotalsCache::SetPlayerLivesLeft(FGameplayPlayerData& PlayerData, const int32 NumLivesLeft)
+{
+	if (FAccelByteWarsTeamTotals* TeamTotals = bDirty ? nullptr : Totals.Find(PlayerData.TeamId))
+	{
+		TeamTotals->LivesLeft += NumLivesLeft - PlayerData.NumLivesLeft;
+	}
+	else
+	{
+		bDirty = true;
+	}
+	PlayerData.NumLivesLeft = NumLivesLeft;
+}
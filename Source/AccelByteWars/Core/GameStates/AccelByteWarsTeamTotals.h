@@ -0,0 +1,52 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/System/AccelByteWarsGameInstance.h"
+
+/**
+ * @brief Sums over a team's members, same values as FGameplayTeamData's GetTeamScore, GetTeamLivesLeft and GetTeamKillCount
+ */
+struct FAccelByteWarsTeamTotals
+{
+	float Score = 0.0f;
+	int32 LivesLeft = 0;
+	int32 KillCount = 0;
+};
+
+/**
+ * @brief Totals of every team in a Teams array, by TeamId. TeamIds stop matching indices in Teams once a team is removed.
+ * Summed again on the first lookup after MarkDirty, kept up to date by the SetPlayer* functions otherwise.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsTeamTotalsCache
+{
+public:
+	/**
+	 * @brief Totals of a team
+	 * @param Teams Teams the totals are summed from, summed again first if dirty
+	 * @param TeamId Target team
+	 * @return nullptr if TeamId is not a valid team
+	 */
+	const FAccelByteWarsTeamTotals* Find(const TArray<FGameplayTeamData>& Teams, const int32 TeamId);
+
+	/**
+	 * @brief Update a member of Teams and its team's totals
+	 * @param PlayerData Member of the Teams the totals are summed from
+	 */
+	void SetPlayerScore(FGameplayPlayerData& PlayerData, const float Score);
+	void SetPlayerKillCount(FGameplayPlayerData& PlayerData, const int32 KillCount);
+	void SetPlayerLivesLeft(FGameplayPlayerData& PlayerData, const int32 NumLivesLeft);
+
+	/**
+	 * @brief Sum again on next lookup. Call after adding, removing or moving members of Teams.
+	 */
+	void MarkDirty() { bDirty = true; }
+
+private:
+	TMap<int32, FAccelByteWarsTeamTotals> Totals;
+
+	bool bDirty = true;
+};
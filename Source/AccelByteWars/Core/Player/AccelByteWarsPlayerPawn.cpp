@@ -4,6 +4,10 @@
 
 #include "Core/Player/AccelByteWarsPlayerPawn.h"
 
+#include "Core/System/AccelByteWarsActorPoolSubsystem.h"
+#include "Core/System/AccelByteWarsClassRegistrySubsystem.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
+
 // Sets default values
 AAccelByteWarsPlayerPawn::AAccelByteWarsPlayerPawn()
 {
@@ -51,7 +55,10 @@ void AAccelByteWarsPlayerPawn::Tick(float DeltaTime)
 		if (MissileTrail != nullptr)
 		{
 			if (MissileTrail->IsFadeOut())
-				MissileTrail->Destroy();
+			{
+				MissileTrail->ReleaseOrDestroy();
+				MissileTrail = nullptr;
+			}
 		}
 
 		// Adjust fire power
@@ -91,6 +98,8 @@ void AAccelByteWarsPlayerPawn::GetLifetimeReplicatedProps(TArray<FLifetimeProper
 
 AAccelByteWarsMissile* AAccelByteWarsPlayerPawn::SpawnMissileInWorld(AActor* ActorOwner, FTransform InTransform, float InitialSpeed, FString BlueprintPath, bool ShouldReplicate)
 {
+	ACCELBYTEWARS_FRAME_SCOPE(Spawning);
+
 	if (ActorOwner == nullptr)
 		return nullptr;
 
@@ -98,9 +107,20 @@ AAccelByteWarsMissile* AAccelByteWarsPlayerPawn::SpawnMissileInWorld(AActor* Act
 	SpawnParameters.Owner = ActorOwner;
 	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	UClass* GenericClass = StaticLoadClass(AActor::StaticClass(), ActorOwner, *BlueprintPath);
+	UAccelByteWarsClassRegistrySubsystem* ClassRegistry = ActorOwner->GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	if (ClassRegistry == nullptr)
+		return nullptr;
+
+	UClass* GenericClass = ClassRegistry->FindOrLoadClass(BlueprintPath);
+
+	// Missiles are recycled by the actor pool
+	AAccelByteWarsMissile* NewActor = nullptr;
+	UAccelByteWarsActorPoolSubsystem* ActorPool = ActorOwner->GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+	if (ActorPool != nullptr && UAccelByteWarsActorPoolSubsystem::IsPoolable(GenericClass))
+		NewActor = ActorPool->AcquireActor<AAccelByteWarsMissile>(GenericClass, InTransform, ActorOwner, this);
+	else
+		NewActor = ActorOwner->GetWorld()->SpawnActor<AAccelByteWarsMissile>(GenericClass, InTransform, SpawnParameters);
 
-	AAccelByteWarsMissile* NewActor = ActorOwner->GetWorld()->SpawnActor<AAccelByteWarsMissile>(GenericClass, InTransform, SpawnParameters);
 	if (NewActor == nullptr)
 		return nullptr;
 
@@ -116,6 +136,8 @@ AAccelByteWarsMissile* AAccelByteWarsPlayerPawn::SpawnMissileInWorld(AActor* Act
 template<class T>
 T* AAccelByteWarsPlayerPawn::SpawnBPActorInWorld(APawn* OwningPawn, const FVector Location, const FRotator Rotation, FString BlueprintPath, bool ShouldReplicate)
 {
+	ACCELBYTEWARS_FRAME_SCOPE(Spawning);
+
 	if (OwningPawn == nullptr)
 		return nullptr;
 
@@ -123,14 +145,25 @@ T* AAccelByteWarsPlayerPawn::SpawnBPActorInWorld(APawn* OwningPawn, const FVecto
 	SpawnParameters.Owner = OwningPawn;
 	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	UClass* GenericClass = StaticLoadClass(AActor::StaticClass(), OwningPawn, *BlueprintPath);
+	UAccelByteWarsClassRegistrySubsystem* ClassRegistry = OwningPawn->GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	if (ClassRegistry == nullptr)
+		return nullptr;
+
+	UClass* GenericClass = ClassRegistry->FindOrLoadClass(BlueprintPath);
 	if (GenericClass == nullptr)
 	{
 		LOG_TO_CONSOLE("Failed to generate generic class for: " + BlueprintPath);
 		return nullptr;
 	}
 
-	T* NewActor = OwningPawn->GetWorld()->SpawnActor<T>(GenericClass, FTransform(Rotation, Location), SpawnParameters);
+	// Poolable classes are recycled by the actor pool
+	T* NewActor = nullptr;
+	UAccelByteWarsActorPoolSubsystem* ActorPool = OwningPawn->GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+	if (ActorPool != nullptr && UAccelByteWarsActorPoolSubsystem::IsPoolable(GenericClass))
+		NewActor = ActorPool->AcquireActor<T>(GenericClass, FTransform(Rotation, Location), OwningPawn, OwningPawn);
+	else
+		NewActor = OwningPawn->GetWorld()->SpawnActor<T>(GenericClass, FTransform(Rotation, Location), SpawnParameters);
+
 	if (NewActor == nullptr)
 	{
 		LOG_TO_CONSOLE("Failed to generate actor class for: " + BlueprintPath);
@@ -425,6 +458,34 @@ FTransform AAccelByteWarsPlayerPawn::CalculateWhereToSpawnMissile()
 	return OutTransform;
 }
 
+bool AAccelByteWarsPlayerPawn::PredictMissileTrajectory(const FRotator& AimRotation, const float InFirePowerLevel, const int32 NumSteps, FAccelByteWarsMissileTrajectory& OutTrajectory)
+{
+	UAccelByteWarsClassRegistrySubsystem* ClassRegistry = GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	if (ClassRegistry == nullptr)
+		return false;
+
+	const UClass* FiredMissileClass = ClassRegistry->FindOrLoadClass(FiredMissileBlueprintPath);
+	if (FiredMissileClass == nullptr || !FiredMissileClass->IsChildOf(AAccelByteWarsMissile::StaticClass()))
+		return false;
+
+	AAccelByteWarsInGameGameState* const ABInGameState = GetWorld()->GetGameState<AAccelByteWarsInGameGameState>();
+	if (ABInGameState == nullptr)
+		return false;
+
+	// Same spawn location and velocity as Server_FireMissile
+	const FVector RightVector = AimRotation.Quaternion().GetRightVector();
+	const FVector StartLocation = (RightVector * 100.0f) + GetActorLocation();
+	const float ClampedInitialSpeed = UKismetMathLibrary::MapRangeClamped(InFirePowerLevel, 0.0f, 1.0f, MinMissileSpeed, MaxMissileSpeed);
+
+	return AAccelByteWarsMissile::PredictTrajectory(
+		ABInGameState,
+		FiredMissileClass->GetDefaultObject<AAccelByteWarsMissile>(),
+		StartLocation,
+		ClampedInitialSpeed * RightVector,
+		NumSteps,
+		OutTrajectory);
+}
+
 bool AAccelByteWarsPlayerPawn::ShouldFire()
 {
 	AAccelByteWarsPlayerState* ABPlayerState = Cast<AAccelByteWarsPlayerState>(GetPlayerState());
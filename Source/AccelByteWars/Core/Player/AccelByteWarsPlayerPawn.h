@@ -214,6 +214,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = AccelByteWars)
 	FTransform CalculateWhereToSpawnMissile();
 
+	/**
+	 * @brief Simulates the missile this ship would fire, without spawning anything. For aim previews and bots.
+	 * @param AimRotation Ship rotation to fire with
+	 * @param InFirePowerLevel Fire power level, 0 to 1
+	 * @param NumSteps Max number of missile simulation steps
+	 * @param OutTrajectory Output: the predicted flight
+	 * @return false if the missile class or the in game game state is not available
+	 */
+	UFUNCTION(BlueprintCallable, Category = AccelByteWars)
+	bool PredictMissileTrajectory(const FRotator& AimRotation, const float InFirePowerLevel, const int32 NumSteps, FAccelByteWarsMissileTrajectory& OutTrajectory);
+
 	/**
 	 * @brief Visually updates the power bar UI
 	 */
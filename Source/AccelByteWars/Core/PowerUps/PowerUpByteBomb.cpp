@@ -6,6 +6,8 @@
 
 #include "AccelByteWars/Core/Actor/AccelByteWarsMissile.h"
 #include "AccelByteWars/Core/Player/AccelByteWarsPlayerPawn.h"
+#include "AccelByteWars/Core/Player/AccelByteWarsPlayerState.h"
+#include "GameFramework/Controller.h"
 
 APowerUpByteBomb::APowerUpByteBomb()
 {
@@ -50,34 +52,35 @@ void APowerUpByteBomb::Server_DestroyAllEnemyMissiles_Implementation(APawn* Byte
 	if (ByteBombOwner == nullptr)
 		return;
 
-	TArray<AActor*> FoundMissiles;
-	UGameplayStatics::GetAllActorsOfClass(ByteBombOwner->GetWorld(), AAccelByteWarsMissile::StaticClass(), FoundMissiles);
+	AAccelByteWarsInGameGameState* ABGameState = ByteBombOwner->GetWorld()->GetGameState<AAccelByteWarsInGameGameState>();
+	if (ABGameState == nullptr)
+		return;
 
-	for (int i = 0; i < FoundMissiles.Num(); i++)
+	TArray<AAccelByteWarsMissile*> EnemyMissiles;
+	for (const TPair<int32, TArray<AAccelByteWarsMissile*>>& Team : ABGameState->GetLiveMissilesByTeam())
 	{
-		AAccelByteWarsMissile* Missile = Cast<AAccelByteWarsMissile>(FoundMissiles[i]);
-		if (Missile == nullptr)
-			continue;
-
-		AAccelByteWarsPlayerPawn* MissileOwner = Cast<AAccelByteWarsPlayerPawn>(Missile->Owner);
-		if (MissileOwner == nullptr)
-			continue;
-
-		AAccelByteWarsPlayerController* ABPlayerController = Cast<AAccelByteWarsPlayerController>(MissileOwner->GetController());
-		if (ABPlayerController == nullptr)
-			continue;
-
-		if (ABPlayerController->PlayerState == nullptr)
-			continue;
-
-		AAccelByteWarsPlayerState* ABPlayerState = static_cast<AAccelByteWarsPlayerState*>(ABPlayerController->PlayerState);
-		if (ABPlayerState == nullptr)
-			continue;
-
-		if (ABPlayerState->TeamId != TeamId)
+		if (Team.Key == INDEX_NONE)
 		{
-			Missile->DestroyByPowerUp();
+			// Owner had no player state when firing, check its team now
+			for (AAccelByteWarsMissile* Missile : Team.Value)
+			{
+				const AAccelByteWarsPlayerPawn* MissileOwner = Cast<AAccelByteWarsPlayerPawn>(Missile->GetOwner());
+				const AController* OwnerController = MissileOwner ? MissileOwner->GetController() : nullptr;
+				const AAccelByteWarsPlayerState* OwnerPlayerState = OwnerController ? OwnerController->GetPlayerState<AAccelByteWarsPlayerState>() : nullptr;
+				if (OwnerPlayerState && OwnerPlayerState->TeamId != TeamId)
+					EnemyMissiles.Add(Missile);
+			}
 		}
+		else if (Team.Key != TeamId)
+		{
+			EnemyMissiles.Append(Team.Value);
+		}
+	}
+
+	// Destroying releases the missile, which modifies the registry
+	for (AAccelByteWarsMissile* Missile : EnemyMissiles)
+	{
+		Missile->DestroyByPowerUp();
 	}
 }
 
@@ -6,6 +6,7 @@
 
 #include "Core/Actor/AccelByteWarsMissile.h"
 #include "Core/Player/AccelByteWarsPlayerPawn.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
 
 #include "Kismet/KismetMathLibrary.h"
 
@@ -34,6 +35,8 @@ APowerUpByteShield::APowerUpByteShield()
 // Called every frame
 void APowerUpByteShield::Tick(float DeltaTime)
 {
+	ACCELBYTEWARS_FRAME_SCOPE(PowerUps);
+
 	if (IsShieldActive)
 	{
 		CurrentCollisionTickRate += DeltaTime;
@@ -62,21 +65,31 @@ void APowerUpByteShield::CheckCollision()
 	if (Owner == nullptr)
 		return;
 
-	TArray<AActor*> FoundMissiles;
-	UGameplayStatics::GetAllActorsOfClass(Owner->GetWorld(), AAccelByteWarsMissile::StaticClass(), FoundMissiles);
+	// Only the server resolves hits
+	if (!HasAuthority())
+		return;
+
+	AAccelByteWarsInGameGameState* ABGameState = Owner->GetWorld()->GetGameState<AAccelByteWarsInGameGameState>();
+	if (ABGameState == nullptr)
+		return;
 
-	for (int i = 0; i < FoundMissiles.Num(); i++)
+	// Hitting the shield releases the missile, which modifies the registry
+	TArray<AAccelByteWarsMissile*, TInlineAllocator<16>> HitMissiles;
+	for (const TPair<int32, TArray<AAccelByteWarsMissile*>>& Team : ABGameState->GetLiveMissilesByTeam())
 	{
-		AAccelByteWarsMissile* ABMissile = Cast<AAccelByteWarsMissile>(FoundMissiles[i]);
-		if (ABMissile == nullptr)
-			return;
+		for (AAccelByteWarsMissile* ABMissile : Team.Value)
+		{
+			float Distance = UKismetMathLibrary::Vector_Distance(this->GetActorLocation(), ABMissile->GetActorLocation());
+			if (Distance > ShieldRadius)
+				continue;
 
-		float Distance = UKismetMathLibrary::Vector_Distance(this->GetActorLocation(), ABMissile->GetActorLocation());
-		if (Distance > ShieldRadius)
-			continue;
+			HitMissiles.Add(ABMissile);
+		}
+	}
 
-		if (HasAuthority())
-			Server_ShieldHitByMissile(ABMissile);
+	for (AAccelByteWarsMissile* ABMissile : HitMissiles)
+	{
+		Server_ShieldHitByMissile(ABMissile);
 	}
 }
 
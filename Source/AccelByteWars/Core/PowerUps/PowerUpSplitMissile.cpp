@@ -4,6 +4,10 @@
 
 #include "Core/PowerUps/PowerUpSplitMissile.h"
 
+#include "Core/System/AccelByteWarsActorPoolSubsystem.h"
+#include "Core/System/AccelByteWarsClassRegistrySubsystem.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
+
 APowerUpSplitMissile::APowerUpSplitMissile()
 {
 	// Set this pawn to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
@@ -29,7 +33,7 @@ void APowerUpSplitMissile::Server_FireMissiles_Implementation(APawn* SplitMissil
 		return;
 
 	// Rotate left missile 90 degrees
-	LeftFiredMissile->Velocity = LeftFiredMissile->InitialSpeed * -GetActorTransform().GetRotation().GetForwardVector();
+	LeftFiredMissile->ApplyVelocity(LeftFiredMissile->InitialSpeed * -GetActorTransform().GetRotation().GetForwardVector());
 
 	// Spawn right missile actor
 	AAccelByteWarsMissile* RightFiredMissile = SpawnMissile(SplitMissileOwner, SpawnTransform, clamped_initial_speed, InColor, InFiredMissileBlueprintPath);
@@ -37,7 +41,7 @@ void APowerUpSplitMissile::Server_FireMissiles_Implementation(APawn* SplitMissil
 		return;
 
 	// Rotate right missile 90 degrees
-	RightFiredMissile->Velocity = RightFiredMissile->InitialSpeed * GetActorTransform().GetRotation().GetForwardVector();
+	RightFiredMissile->ApplyVelocity(RightFiredMissile->InitialSpeed * GetActorTransform().GetRotation().GetForwardVector());
 
 	// Spawn left missile trail
 	AAccelByteWarsMissileTrail* LeftMissileTrail = SpawnBPActorInWorld<AAccelByteWarsMissileTrail>(SplitMissileOwner, SpawnTransform.GetLocation(), SpawnTransform.Rotator(), InFiredMissileTrailBlueprintPath, true);
@@ -82,6 +86,8 @@ AAccelByteWarsMissile* APowerUpSplitMissile::SpawnMissile(APawn* SplitMissileOwn
 template<class T>
 T* APowerUpSplitMissile::SpawnBPActorInWorld(APawn* OwningPawn, const FVector Location, const FRotator Rotation, FString BlueprintPath, bool ShouldReplicate)
 {
+	ACCELBYTEWARS_FRAME_SCOPE(Spawning);
+
 	if (OwningPawn == nullptr)
 		return nullptr;
 
@@ -89,14 +95,25 @@ T* APowerUpSplitMissile::SpawnBPActorInWorld(APawn* OwningPawn, const FVector Lo
 	spawn_parameters.Owner = OwningPawn;
 	spawn_parameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
-	UClass* generic_class = StaticLoadClass(AActor::StaticClass(), OwningPawn, *BlueprintPath);
+	UAccelByteWarsClassRegistrySubsystem* class_registry = OwningPawn->GetWorld()->GetSubsystem<UAccelByteWarsClassRegistrySubsystem>();
+	if (class_registry == nullptr)
+		return nullptr;
+
+	UClass* generic_class = class_registry->FindOrLoadClass(BlueprintPath);
 	if (generic_class == nullptr)
 	{
 		LOG_TO_CONSOLE("Failed to generate generic class for: " + BlueprintPath);
 		return nullptr;
 	}
 
-	T* new_actor = OwningPawn->GetWorld()->SpawnActor<T>(generic_class, FTransform(Rotation, Location), spawn_parameters);
+	// Poolable classes are recycled by the actor pool
+	T* new_actor = nullptr;
+	UAccelByteWarsActorPoolSubsystem* actor_pool = OwningPawn->GetWorld()->GetSubsystem<UAccelByteWarsActorPoolSubsystem>();
+	if (actor_pool != nullptr && UAccelByteWarsActorPoolSubsystem::IsPoolable(generic_class))
+		new_actor = actor_pool->AcquireActor<T>(generic_class, FTransform(Rotation, Location), OwningPawn, OwningPawn);
+	else
+		new_actor = OwningPawn->GetWorld()->SpawnActor<T>(generic_class, FTransform(Rotation, Location), spawn_parameters);
+
 	if (new_actor == nullptr)
 	{
 		LOG_TO_CONSOLE("Failed to generate actor class for: " + BlueprintPath);
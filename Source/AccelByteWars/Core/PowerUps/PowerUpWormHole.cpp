@@ -5,6 +5,7 @@
 #include "Core/PowerUps/PowerUpWormHole.h"
 
 #include "Core/Player/AccelByteWarsPlayerPawn.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
 
 APowerUpWormHole::APowerUpWormHole()
 {
@@ -32,6 +33,8 @@ APowerUpWormHole::APowerUpWormHole()
 // Called every frame
 void APowerUpWormHole::Tick(float DeltaTime)
 {
+	ACCELBYTEWARS_FRAME_SCOPE(PowerUps);
+
 	if (MarkAsExpired)
 	{	
 		CurrentWormHoleLifetime += DeltaTime;
@@ -63,11 +66,9 @@ void APowerUpWormHole::Server_InitiateWormHoleGenerator_Implementation()
 	{
 		return;
 	}
+	// false means the least crowded spot of the arena was used, a crowded arena still moves the ship
 	FVector2D Position2D;
-	if (!InGameGameMode->FindGoodSpawnLocation(Position2D))
-	{
-		return;
-	}
+	InGameGameMode->FindGoodSpawnLocation(Position2D);
 	const FVector NewPawnLocation = {Position2D.X, Position2D.Y, 0.0f};;
 
 	Multicast_InitiateWormHoleGenerator(ABPawn, NewPawnLocation);
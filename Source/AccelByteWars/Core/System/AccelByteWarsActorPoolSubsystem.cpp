@@ -0,0 +1,217 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsActorPoolSubsystem.h"
+
+#include "Core/System/AccelByteWarsFrameStats.h"
+#include "Core/System/AccelByteWarsPoolableActorInterface.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteWarsActorPool);
+
+void UAccelByteWarsActorPoolSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &ThisClass::OnPreGarbageCollect);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &ThisClass::OnPostGarbageCollect);
+}
+
+void UAccelByteWarsActorPoolSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+
+	if (NumSpawned > 0 || NumReused > 0)
+	{
+		ACTORPOOL_LOG(Log, TEXT("Pooling %s: %d spawned in %.3f ms, %d reused, %d released. GC: %d collections in %.3f ms"),
+			bEnabled ? TEXT("enabled") : TEXT("disabled"),
+			NumSpawned, SpawnSeconds * 1000.0, NumReused, NumReleased,
+			NumGarbageCollections, GarbageCollectSeconds * 1000.0);
+	}
+
+	if (NumReplicatedSpawned > 0 || NumReplicatedReused > 0)
+	{
+		ACTORPOOL_LOG(Log, TEXT("Replicated pooled actors: %d instances allocated, %d reused. GC: %d collections in %.3f ms"),
+			NumReplicatedSpawned, NumReplicatedReused, NumGarbageCollections, GarbageCollectSeconds * 1000.0);
+	}
+
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UAccelByteWarsActorPoolSubsystem::IsPoolable(const UClass* ActorClass)
+{
+	return ActorClass && ActorClass->ImplementsInterface(UAccelByteWarsPoolableActorInterface::StaticClass());
+}
+
+AActor* UAccelByteWarsActorPoolSubsystem::AcquireActor(UClass* ActorClass, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+	ACCELBYTEWARS_FRAME_SCOPE(Spawning);
+
+	if (!ActorClass)
+	{
+		return nullptr;
+	}
+
+	AActor* Actor = nullptr;
+	if (FAccelByteWarsActorPoolEntry* Entry = Pools.Find(ActorClass))
+	{
+		// instances destroyed while idle (e.g. by level streaming) are skipped
+		while (!Actor && !Entry->FreeActors.IsEmpty())
+		{
+			AActor* Candidate = Entry->FreeActors.Pop(false);
+			if (IsValid(Candidate))
+			{
+				Actor = Candidate;
+			}
+		}
+	}
+
+	if (!Actor)
+	{
+		return SpawnActor(ActorClass, Transform, Owner, Instigator, false);
+	}
+
+	Actor->SetNetDormancy(ActorClass->GetDefaultObject<AActor>()->NetDormancy);
+	Actor->SetOwner(Owner);
+	Actor->SetInstigator(Instigator);
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(ActorClass->GetDefaultObject<AActor>()->GetActorEnableCollision());
+	Actor->SetActorTickEnabled(ActorClass->GetDefaultObject<AActor>()->PrimaryActorTick.bStartWithTickEnabled);
+	Actor->ForceNetUpdate();
+
+	Cast<IAccelByteWarsPoolableActorInterface>(Actor)->OnAcquiredFromPool();
+	NumReused++;
+
+	return Actor;
+}
+
+bool UAccelByteWarsActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!bEnabled || !IsValid(Actor) || !IsPoolable(Actor->GetClass()) || !Actor->HasActorBegunPlay())
+	{
+		return false;
+	}
+
+	// released twice in the same frame, e.g. by a hit and by a blueprint destroy
+	if (IsActorInPool(Actor))
+	{
+		return true;
+	}
+
+	FAccelByteWarsActorPoolEntry& Entry = Pools.FindOrAdd(Actor->GetClass());
+	if (Entry.FreeActors.Num() >= FMath::Max(Entry.Capacity, MaxFreeActorsPerClass))
+	{
+		return false;
+	}
+
+	Cast<IAccelByteWarsPoolableActorInterface>(Actor)->OnReleasedToPool();
+	DeactivateActor(Actor);
+
+	// the channel closes once the hidden state is sent, clients keep their instance
+	if (Actor->GetIsReplicated())
+	{
+		Actor->SetNetDormancy(DORM_DormantAll);
+	}
+
+	Entry.FreeActors.Add(Actor);
+	NumReleased++;
+
+	OnActorReleased.Broadcast(Actor);
+
+	return true;
+}
+
+void UAccelByteWarsActorPoolSubsystem::PrewarmActors(UClass* ActorClass, const int32 Count)
+{
+	if (!bEnabled || !IsPoolable(ActorClass))
+	{
+		return;
+	}
+
+	// every prewarmed instance must fit back into the pool, or the surplus is destroyed on release and spawned again
+	FAccelByteWarsActorPoolEntry& Entry = Pools.FindOrAdd(ActorClass);
+	if (Count > FMath::Max(Entry.Capacity, MaxFreeActorsPerClass))
+	{
+		ACTORPOOL_LOG(Log, TEXT("Keeping up to %d idle %s instead of %d (MaxFreeActorsPerClass)"), Count, *ActorClass->GetName(), MaxFreeActorsPerClass);
+		Entry.Capacity = Count;
+	}
+
+	// the class is already in Pools, SpawnActor adds to this entry without moving it
+	for (int32 i = Entry.FreeActors.Num(); i < Count; ++i)
+	{
+		SpawnActor(ActorClass, FTransform::Identity, nullptr, nullptr, true);
+	}
+}
+
+bool UAccelByteWarsActorPoolSubsystem::IsActorInPool(const AActor* Actor) const
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	const FAccelByteWarsActorPoolEntry* Entry = Pools.Find(Actor->GetClass());
+	return Entry && Entry->FreeActors.Contains(Actor);
+}
+
+AActor* UAccelByteWarsActorPoolSubsystem::SpawnActor(UClass* ActorClass, const FTransform& Transform, AActor* Owner, APawn* Instigator, const bool bIntoPool)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	AActor* Actor = GetWorld()->SpawnActorDeferred<AActor>(ActorClass, Transform, Owner, Instigator, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	// pooled before BeginPlay so that the actor knows it is idle
+	if (bIntoPool)
+	{
+		Pools.FindOrAdd(ActorClass).FreeActors.Add(Actor);
+		DeactivateActor(Actor);
+	}
+
+	Actor->FinishSpawning(Transform);
+
+	SpawnSeconds += FPlatformTime::Seconds() - StartTime;
+	NumSpawned++;
+
+	return Actor;
+}
+
+void UAccelByteWarsActorPoolSubsystem::DeactivateActor(AActor* Actor) const
+{
+	GetWorld()->GetTimerManager().ClearAllTimersForObject(Actor);
+	GetWorld()->GetLatentActionManager().RemoveActionsForObject(Actor);
+
+	// bindings on the previous owner must not reach the next user of this instance
+	if (AActor* Owner = Actor->GetOwner())
+	{
+		Owner->OnDestroyed.RemoveAll(Actor);
+	}
+
+	Actor->SetOwner(nullptr);
+	Actor->SetInstigator(nullptr);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Actor->ForceNetUpdate();
+}
+
+void UAccelByteWarsActorPoolSubsystem::OnPreGarbageCollect()
+{
+	GarbageCollectStartTime = FPlatformTime::Seconds();
+}
+
+void UAccelByteWarsActorPoolSubsystem::OnPostGarbageCollect()
+{
+	GarbageCollectSeconds += FPlatformTime::Seconds() - GarbageCollectStartTime;
+	NumGarbageCollections++;
+}
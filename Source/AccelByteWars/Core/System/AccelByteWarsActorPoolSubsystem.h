@@ -0,0 +1,126 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AccelByteWarsActorPoolSubsystem.generated.h"
+
+ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsActorPool, Log, All);
+
+#define ACTORPOOL_LOG(Verbosity, Format, ...) \
+{ \
+	UE_LOG(LogAccelByteWarsActorPool, Verbosity, TEXT("%s"), *FString::Printf(Format, ##__VA_ARGS__)); \
+}
+
+USTRUCT()
+struct FAccelByteWarsActorPoolEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<AActor*> FreeActors;
+
+	/**
+	 * @brief Idle instances kept for this class when more than MaxFreeActorsPerClass were prewarmed, 0 otherwise
+	 */
+	int32 Capacity = 0;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnActorReleasedToPool, AActor* /*Actor*/);
+
+/**
+ * Per world pool of actors implementing IAccelByteWarsPoolableActorInterface.
+ * Released actors are hidden, have collision disabled and go net dormant, clients keep their instance and reuse it
+ * when the channel wakes up. Spawn and garbage collection time are counted and logged when the world ends.
+ */
+UCLASS(config = Game)
+class ACCELBYTEWARS_API UAccelByteWarsActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~UWorldSubsystem overridden functions
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of UWorldSubsystem overridden functions
+
+	static bool IsPoolable(const UClass* ActorClass);
+
+	/**
+	 * @brief Take an idle instance of ActorClass, or spawn one if there is none
+	 * @param ActorClass Class to be acquired
+	 * @param Transform Actor transform
+	 * @param Owner Actor owner
+	 * @param Instigator Actor instigator
+	 * @return nullptr if the actor can't be spawned
+	 */
+	AActor* AcquireActor(UClass* ActorClass, const FTransform& Transform, AActor* Owner, APawn* Instigator);
+
+	template<class T>
+	T* AcquireActor(UClass* ActorClass, const FTransform& Transform, AActor* Owner, APawn* Instigator)
+	{
+		return Cast<T>(AcquireActor(ActorClass, Transform, Owner, Instigator));
+	}
+
+	/**
+	 * @brief Give an actor back to the pool
+	 * @return false if the actor is not poolable, pooling is disabled or the pool is full. Caller should destroy it.
+	 */
+	bool ReleaseActor(AActor* Actor);
+
+	/**
+	 * @brief Spawn idle instances until the pool of ActorClass holds at least Count actors.
+	 * The pool of ActorClass keeps up to Count idle instances from then on if that is more than MaxFreeActorsPerClass.
+	 */
+	void PrewarmActors(UClass* ActorClass, const int32 Count);
+
+	bool IsActorInPool(const AActor* Actor) const;
+
+	/**
+	 * @brief Client side counters, called by poolable actors received from the server
+	 */
+	void OnReplicatedInstanceSpawned() { NumReplicatedSpawned++; }
+	void OnReplicatedInstanceReused() { NumReplicatedReused++; }
+
+	/**
+	 * @brief Broadcast on the server when an actor goes idle in the pool. The actor is not destroyed, its OnDestroyed is not called.
+	 */
+	FOnActorReleasedToPool OnActorReleased;
+
+	UPROPERTY(config)
+	bool bEnabled = true;
+
+	/**
+	 * @brief Idle instances kept per class unless more were prewarmed, actors released beyond this are destroyed
+	 */
+	UPROPERTY(config)
+	int32 MaxFreeActorsPerClass = 64;
+
+private:
+	AActor* SpawnActor(UClass* ActorClass, const FTransform& Transform, AActor* Owner, APawn* Instigator, const bool bIntoPool);
+	void DeactivateActor(AActor* Actor) const;
+
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+
+	UPROPERTY(Transient)
+	TMap<UClass*, FAccelByteWarsActorPoolEntry> Pools;
+
+	int32 NumSpawned = 0;
+	int32 NumReused = 0;
+	int32 NumReleased = 0;
+	double SpawnSeconds = 0.0;
+
+	int32 NumReplicatedSpawned = 0;
+	int32 NumReplicatedReused = 0;
+
+	int32 NumGarbageCollections = 0;
+	double GarbageCollectSeconds = 0.0;
+	double GarbageCollectStartTime = 0.0;
+
+	FDelegateHandle PreGarbageCollectHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+};
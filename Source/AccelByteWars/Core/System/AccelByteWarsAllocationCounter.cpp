@@ -0,0 +1,177 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsAllocationCounter.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "HAL/MemoryBase.h"
+
+namespace
+{
+	/**
+	 * Forwards everything to the allocator it wraps, counting while a FAccelByteWarsScopedAllocationCounter is alive.
+	 * Never destroyed, it replaces GMalloc for the rest of the process.
+	 */
+	class FAccelByteWarsCountingMalloc final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+
+		// game thread only
+		bool bCounting = false;
+		int64 NumAllocations = 0;
+		int64 NumBytes = 0;
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			AddAllocation(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			AddAllocation(Count);
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			AddReallocation(Count);
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			AddReallocation(Count);
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			Inner->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return Inner->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return Inner->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual void Trim(bool bTrimThreadCaches) override
+		{
+			Inner->Trim(bTrimThreadCaches);
+		}
+
+		virtual void SetupTLSCachesOnCurrentThread() override
+		{
+			Inner->SetupTLSCachesOnCurrentThread();
+		}
+
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			Inner->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		virtual void UpdateStats() override
+		{
+			Inner->UpdateStats();
+		}
+
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+		{
+			Inner->GetAllocatorStats(OutStats);
+		}
+
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override
+		{
+			Inner->DumpAllocatorStats(Ar);
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return Inner->IsInternallyThreadSafe();
+		}
+
+		virtual bool ValidateHeap() override
+		{
+			return Inner->ValidateHeap();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return Inner->GetDescriptiveName();
+		}
+
+	private:
+		void AddAllocation(const SIZE_T Count)
+		{
+			if (bCounting && IsInGameThread())
+			{
+				NumAllocations++;
+				NumBytes += Count;
+			}
+		}
+
+		void AddReallocation(const SIZE_T Count)
+		{
+			// a realloc to zero is a free, any other size may move the block
+			if (Count > 0)
+			{
+				AddAllocation(Count);
+			}
+		}
+	};
+
+	FAccelByteWarsCountingMalloc& GetCountingMalloc()
+	{
+		static FAccelByteWarsCountingMalloc* CountingMalloc = new FAccelByteWarsCountingMalloc();
+		return *CountingMalloc;
+	}
+}
+
+FAccelByteWarsScopedAllocationCounter::FAccelByteWarsScopedAllocationCounter()
+{
+	FAccelByteWarsCountingMalloc& CountingMalloc = GetCountingMalloc();
+	if (!ensureMsgf(IsInGameThread() && !CountingMalloc.bCounting, TEXT("Allocation counters count the game thread, one at a time")))
+	{
+		return;
+	}
+
+	// the allocator is wrapped once and stays wrapped, swapping it back and forth would race with the other threads
+	if (CountingMalloc.Inner == nullptr)
+	{
+		CountingMalloc.Inner = GMalloc;
+		GMalloc = &CountingMalloc;
+	}
+
+	CountingMalloc.NumAllocations = 0;
+	CountingMalloc.NumBytes = 0;
+	CountingMalloc.bCounting = true;
+	bCounting = true;
+}
+
+FAccelByteWarsScopedAllocationCounter::~FAccelByteWarsScopedAllocationCounter()
+{
+	if (bCounting)
+	{
+		GetCountingMalloc().bCounting = false;
+	}
+}
+
+int64 FAccelByteWarsScopedAllocationCounter::GetNumAllocations() const
+{
+	return bCounting ? GetCountingMalloc().NumAllocations : 0;
+}
+
+int64 FAccelByteWarsScopedAllocationCounter::GetNumBytes() const
+{
+	return bCounting ? GetCountingMalloc().NumBytes : 0;
+}
+
+#endif // !UE_BUILD_SHIPPING
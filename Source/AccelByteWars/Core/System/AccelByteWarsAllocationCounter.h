@@ -0,0 +1,36 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Counts the heap allocations made by the game thread while it is alive, for benchmarks and perf tests.
+ * The first counter wraps GMalloc in a forwarding allocator that stays in place, the wrapper only counts while a counter
+ * is alive. One counter at a time, allocations of other threads are not counted.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsScopedAllocationCounter
+{
+public:
+	FAccelByteWarsScopedAllocationCounter();
+	~FAccelByteWarsScopedAllocationCounter();
+
+	/**
+	 * @brief Malloc and Realloc calls of the game thread so far, a Realloc to zero bytes is not counted
+	 */
+	int64 GetNumAllocations() const;
+
+	/**
+	 * @brief Bytes requested by those calls
+	 */
+	int64 GetNumBytes() const;
+
+private:
+	bool bCounting = false;
+};
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,148 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsClassRegistrySubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Misc/PackageName.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteWarsClassRegistry);
+
+void UAccelByteWarsClassRegistrySubsystem::Deinitialize()
+{
+	if (NumCacheMisses > 0)
+	{
+		CLASSREGISTRY_LOG(Log, TEXT("%d class lookups missed the cache, preload their paths"), NumCacheMisses);
+	}
+
+	for (const TSharedPtr<FStreamableHandle>& Handle : AsyncPreloadHandles)
+	{
+		if (Handle.IsValid() && Handle->IsLoadingInProgress())
+		{
+			Handle->CancelHandle();
+		}
+	}
+	AsyncPreloadHandles.Empty();
+	NumPendingAsyncPreloads = 0;
+	OnAsyncPreloadsCompleted.Clear();
+
+	Classes.Empty();
+
+	Super::Deinitialize();
+}
+
+UClass* UAccelByteWarsClassRegistrySubsystem::FindOrLoadClass(const FString& BlueprintPath)
+{
+	if (BlueprintPath.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	if (UClass* const* CachedClass = Classes.Find(BlueprintPath))
+	{
+		return *CachedClass;
+	}
+
+	NumCacheMisses++;
+	CLASSREGISTRY_LOG(Verbose, TEXT("Cache miss: %s"), *BlueprintPath);
+
+	return LoadClass(BlueprintPath);
+}
+
+void UAccelByteWarsClassRegistrySubsystem::PreloadClasses(const TArray<FString>& BlueprintPaths)
+{
+	for (const FString& BlueprintPath : BlueprintPaths)
+	{
+		if (!BlueprintPath.IsEmpty() && !Classes.Contains(BlueprintPath))
+		{
+			LoadClass(BlueprintPath);
+		}
+	}
+}
+
+void UAccelByteWarsClassRegistrySubsystem::PreloadClassesAsync(const TArray<FString>& BlueprintPaths, const FSimpleDelegate& OnPreloaded)
+{
+	TArray<FString> PendingPaths;
+	TArray<FSoftObjectPath> ObjectPaths;
+	for (const FString& BlueprintPath : BlueprintPaths)
+	{
+		if (!BlueprintPath.IsEmpty() && !Classes.Contains(BlueprintPath) && !PendingPaths.Contains(BlueprintPath))
+		{
+			PendingPaths.Add(BlueprintPath);
+
+			// strip the "Blueprint'...'" export text wrapper
+			ObjectPaths.Add(FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(BlueprintPath)));
+		}
+	}
+
+	if (ObjectPaths.IsEmpty())
+	{
+		OnPreloaded.ExecuteIfBound();
+		return;
+	}
+
+	// counted before the request, its callback may run before RequestAsyncLoad returns
+	NumPendingAsyncPreloads++;
+	const TSharedRef<bool> bCompleted = MakeShared<bool>(false);
+	const auto OnLoaded = [this, PendingPaths, OnPreloaded, bCompleted]()
+	{
+		if (*bCompleted)
+		{
+			return;
+		}
+		*bCompleted = true;
+
+		for (const FString& BlueprintPath : PendingPaths)
+		{
+			if (Classes.Contains(BlueprintPath))
+			{
+				continue;
+			}
+
+			// a failed path stays unresolved, FindOrLoadClass retries and reports it
+			UClass* LoadedClass = Cast<UClass>(FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(BlueprintPath)).ResolveObject());
+			if (LoadedClass && LoadedClass->IsChildOf(AActor::StaticClass()))
+			{
+				Classes.Add(BlueprintPath, LoadedClass);
+			}
+		}
+
+		// preloads requested by the callback are counted before this one is done
+		OnPreloaded.ExecuteIfBound();
+
+		NumPendingAsyncPreloads--;
+		if (NumPendingAsyncPreloads == 0)
+		{
+			OnAsyncPreloadsCompleted.Broadcast();
+		}
+	};
+
+	const TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ObjectPaths,
+		FStreamableDelegate::CreateWeakLambda(this, OnLoaded));
+
+	if (Handle.IsValid())
+	{
+		AsyncPreloadHandles.Add(Handle);
+	}
+	else
+	{
+		// nothing valid to stream, the callback is never called
+		OnLoaded();
+	}
+}
+
+UClass* UAccelByteWarsClassRegistrySubsystem::LoadClass(const FString& BlueprintPath)
+{
+	UClass* LoadedClass = StaticLoadClass(AActor::StaticClass(), this, *BlueprintPath);
+	if (!LoadedClass)
+	{
+		CLASSREGISTRY_LOG(Warning, TEXT("Failed to load class: %s"), *BlueprintPath);
+		return nullptr;
+	}
+
+	Classes.Add(BlueprintPath, LoadedClass);
+	return LoadedClass;
+}
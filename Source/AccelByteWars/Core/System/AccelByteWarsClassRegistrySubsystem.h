@@ -0,0 +1,77 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AccelByteWarsClassRegistrySubsystem.generated.h"
+
+ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsClassRegistry, Log, All);
+
+#define CLASSREGISTRY_LOG(Verbosity, Format, ...) \
+{ \
+	UE_LOG(LogAccelByteWarsClassRegistry, Verbosity, TEXT("%s"), *FString::Printf(Format, ##__VA_ARGS__)); \
+}
+
+/**
+ * Resolves blueprint classes from their path once per world and serves them from a cache afterwards.
+ * Gameplay code spawning by blueprint path goes through here instead of calling StaticLoadClass on every spawn.
+ */
+UCLASS()
+class ACCELBYTEWARS_API UAccelByteWarsClassRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~UWorldSubsystem overridden functions
+	virtual void Deinitialize() override;
+	//~End of UWorldSubsystem overridden functions
+
+	/**
+	 * @brief Get the class at BlueprintPath. Paths not resolved yet are loaded now and counted as cache miss.
+	 * @param BlueprintPath Class path, e.g. "Blueprint'/Game/ByteWars/Blueprints/Missiles/ABMissile.ABMissile_C'"
+	 * @return nullptr if the path is empty or does not point to a class
+	 */
+	UClass* FindOrLoadClass(const FString& BlueprintPath);
+
+	/**
+	 * @brief Resolve classes ahead of time, e.g. at match load. Does not count as cache miss.
+	 */
+	void PreloadClasses(const TArray<FString>& BlueprintPaths);
+
+	/**
+	 * @brief Resolve classes in the background, e.g. while waiting for players. Does not count as cache miss.
+	 * @param OnPreloaded Called once the classes are resolved, right away if none needs loading
+	 */
+	void PreloadClassesAsync(const TArray<FString>& BlueprintPaths, const FSimpleDelegate& OnPreloaded = FSimpleDelegate());
+
+	/**
+	 * @brief Whether async preloads are in flight, including the ones requested by a completion callback
+	 */
+	bool IsAsyncPreloading() const { return NumPendingAsyncPreloads > 0; }
+
+	/**
+	 * @brief Broadcast when the last async preload in flight completed, after its completion callback
+	 */
+	FSimpleMulticastDelegate OnAsyncPreloadsCompleted;
+
+	/**
+	 * @brief Number of FindOrLoadClass calls that had to resolve a path, should stay at 0 during a match
+	 */
+	int32 GetNumCacheMisses() const { return NumCacheMisses; }
+
+private:
+	UClass* LoadClass(const FString& BlueprintPath);
+
+	UPROPERTY(Transient)
+	TMap<FString, UClass*> Classes;
+
+	int32 NumCacheMisses = 0;
+
+	TArray<TSharedPtr<FStreamableHandle>> AsyncPreloadHandles;
+
+	int32 NumPendingAsyncPreloads = 0;
+};
@@ -0,0 +1,144 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsFrameBudgetSubsystem.h"
+
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
+#include "HAL/FileManager.h"
+#include "Misc/CoreDelegates.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteWarsFrameBudget);
+
+bool UAccelByteWarsFrameBudgetSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	float Budget;
+	return GetBudgetMs(Budget) && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAccelByteWarsFrameBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	GetBudgetMs(BudgetMs);
+
+	FString CsvPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("-FrameBudgetCsv="), CsvPath) && !CsvPath.IsEmpty())
+	{
+		const bool bIsNewFile = IFileManager::Get().FileSize(*CsvPath) <= 0;
+		CsvWriter.Reset(IFileManager::Get().CreateFileWriter(*CsvPath, FILEWRITE_Append | FILEWRITE_AllowRead));
+		if (!CsvWriter.IsValid())
+		{
+			FRAMEBUDGET_LOG(Warning, TEXT("Failed to open frame budget CSV %s"), *CsvPath);
+		}
+		else if (bIsNewFile)
+		{
+			WriteCsvHeader();
+		}
+	}
+
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &ThisClass::OnWorldTickStart);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &ThisClass::OnEndFrame);
+}
+
+void UAccelByteWarsFrameBudgetSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	if (NumFramesOverBudget > 0)
+	{
+		FRAMEBUDGET_LOG(Log, TEXT("%d frames over the %.2f ms budget in %s"), NumFramesOverBudget, BudgetMs, *GetWorld()->GetMapName());
+	}
+
+	// Closes the file
+	CsvWriter.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAccelByteWarsFrameBudgetSubsystem::GetBudgetMs(float& OutBudgetMs)
+{
+	return FParse::Value(FCommandLine::Get(), TEXT("-FrameBudgetMs="), OutBudgetMs) && OutBudgetMs > 0.0f;
+}
+
+void UAccelByteWarsFrameBudgetSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// Worlds without a match (e.g. main menu) have no budget to keep
+	FrameStartCycles = World->GetGameState<AAccelByteWarsInGameGameState>() != nullptr ? FPlatformTime::Cycles64() : 0;
+	FAccelByteWarsFrameScopeTimer::ResetFrame();
+}
+
+void UAccelByteWarsFrameBudgetSubsystem::OnEndFrame()
+{
+	if (FrameStartCycles == 0)
+	{
+		return;
+	}
+
+	const double TotalMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles);
+	FrameStartCycles = 0;
+
+	const bool bIsOverBudget = TotalMs > BudgetMs;
+	if (!bIsOverBudget && !CsvWriter.IsValid())
+	{
+		return;
+	}
+
+	// key=value for the log, comma separated for the CSV, both in EAccelByteWarsFrameScope order
+	FString Breakdown;
+	FString CsvColumns;
+	double ScopesMs = 0.0;
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteWarsFrameScope::Num); ++Index)
+	{
+		const EAccelByteWarsFrameScope Scope = static_cast<EAccelByteWarsFrameScope>(Index);
+		const double ScopeMs = FPlatformTime::ToMilliseconds64(FAccelByteWarsFrameScopeTimer::GetFrameCycles(Scope));
+		ScopesMs += ScopeMs;
+
+		Breakdown += FString::Printf(TEXT(" %s_ms=%.3f"), FAccelByteWarsFrameScopeTimer::GetScopeName(Scope), ScopeMs);
+		CsvColumns += FString::Printf(TEXT(",%.3f"), ScopeMs);
+	}
+
+	// Engine work: actor ticks, physics, net driver tick and flush, garbage collection
+	const double OtherMs = FMath::Max(TotalMs - ScopesMs, 0.0);
+
+	if (bIsOverBudget)
+	{
+		NumFramesOverBudget++;
+		FRAMEBUDGET_LOG(Warning, TEXT("Frame over budget: frame=%llu total_ms=%.3f budget_ms=%.3f%s other_ms=%.3f"),
+			GFrameCounter, TotalMs, BudgetMs, *Breakdown, OtherMs);
+	}
+
+	if (CsvWriter.IsValid())
+	{
+		const AAccelByteWarsInGameGameState* ABGameState = GetWorld()->GetGameState<AAccelByteWarsInGameGameState>();
+		const FString GameStatus = ABGameState ? UEnum::GetValueAsString(ABGameState->GameStatus) : TEXT("");
+
+		WriteCsvLine(FString::Printf(TEXT("%llu,%s,%.3f,%d%s,%.3f"),
+			GFrameCounter, *GameStatus, TotalMs, bIsOverBudget ? 1 : 0, *CsvColumns, OtherMs));
+	}
+}
+
+void UAccelByteWarsFrameBudgetSubsystem::WriteCsvHeader() const
+{
+	FString Header = TEXT("frame,game_status,total_ms,over_budget");
+	for (int32 Index = 0; Index < static_cast<int32>(EAccelByteWarsFrameScope::Num); ++Index)
+	{
+		Header += FString::Printf(TEXT(",%s_ms"), FAccelByteWarsFrameScopeTimer::GetScopeName(static_cast<EAccelByteWarsFrameScope>(Index)));
+	}
+	Header += TEXT(",other_ms");
+
+	WriteCsvLine(Header);
+}
+
+void UAccelByteWarsFrameBudgetSubsystem::WriteCsvLine(const FString& Line) const
+{
+	const FTCHARToUTF8 Utf8Line(*(Line + TEXT("\n")));
+	CsvWriter->Serialize(const_cast<void*>(static_cast<const void*>(Utf8Line.Get())), Utf8Line.Length());
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AccelByteWarsFrameBudgetSubsystem.generated.h"
+
+ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsFrameBudget, Log, All);
+
+#define FRAMEBUDGET_LOG(Verbosity, Format, ...) \
+{ \
+	UE_LOG(LogAccelByteWarsFrameBudget, Verbosity, TEXT("%s"), *FString::Printf(Format, ##__VA_ARGS__)); \
+}
+
+/**
+ * Warns about frames whose game thread work exceeds a budget, with the time of every ACCELBYTEWARS_FRAME_SCOPE.
+ * Only created when the process runs with -FrameBudgetMs=<ms>, e.g. a headless server:
+ * AccelByteWarsServer -nullrhi -FrameBudgetMs=16 -FrameBudgetCsv=Saved/Perf/Frames.csv
+ * A frame lasts from the world tick start to the end of the engine frame, so the tick rate sleep is not counted.
+ * With -FrameBudgetCsv=<file> every frame of a match is appended to the file, the header is written if the file is new.
+ */
+UCLASS()
+class ACCELBYTEWARS_API UAccelByteWarsFrameBudgetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~UWorldSubsystem overridden functions
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of UWorldSubsystem overridden functions
+
+	/**
+	 * @brief Frame budget from the command line
+	 * @return false if -FrameBudgetMs is not set
+	 */
+	static bool GetBudgetMs(float& OutBudgetMs);
+
+private:
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime);
+	void OnEndFrame();
+
+	void WriteCsvHeader() const;
+	void WriteCsvLine(const FString& Line) const;
+
+	float BudgetMs = 0.0f;
+
+	/**
+	 * @brief Cycles when this world started ticking, 0 if the current frame is not measured
+	 */
+	uint64 FrameStartCycles = 0;
+
+	int32 NumFramesOverBudget = 0;
+
+	TUniquePtr<FArchive> CsvWriter;
+
+	FDelegateHandle WorldTickStartHandle;
+	FDelegateHandle EndFrameHandle;
+};
@@ -0,0 +1,86 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsFrameStats.h"
+
+DEFINE_STAT(STAT_AccelByteWars_MissileForces);
+DEFINE_STAT(STAT_AccelByteWars_MissileIntegrate);
+DEFINE_STAT(STAT_AccelByteWars_MissileLifetime);
+DEFINE_STAT(STAT_AccelByteWars_GameModeTick);
+DEFINE_STAT(STAT_AccelByteWars_GameStatus);
+DEFINE_STAT(STAT_AccelByteWars_PowerUps);
+DEFINE_STAT(STAT_AccelByteWars_Spawning);
+DEFINE_STAT(STAT_AccelByteWars_Replication);
+
+CSV_DEFINE_CATEGORY_MODULE(ACCELBYTEWARS_API, AccelByteWars, true);
+
+FAccelByteWarsFrameScopeTimer* FAccelByteWarsFrameScopeTimer::Current = nullptr;
+uint64 FAccelByteWarsFrameScopeTimer::FrameCycles[static_cast<int32>(EAccelByteWarsFrameScope::Num)] = {};
+
+FAccelByteWarsFrameScopeTimer::FAccelByteWarsFrameScopeTimer(const EAccelByteWarsFrameScope InScope)
+	: Scope(InScope)
+{
+	// the budget only covers the game thread
+	if (!IsInGameThread())
+	{
+		return;
+	}
+
+	const uint64 Now = FPlatformTime::Cycles64();
+	Parent = Current;
+	if (Parent)
+	{
+		FrameCycles[static_cast<int32>(Parent->Scope)] += Now - Parent->StartCycles;
+	}
+
+	StartCycles = Now;
+	Current = this;
+}
+
+FAccelByteWarsFrameScopeTimer::~FAccelByteWarsFrameScopeTimer()
+{
+	if (Current != this)
+	{
+		return;
+	}
+
+	const uint64 Now = FPlatformTime::Cycles64();
+	FrameCycles[static_cast<int32>(Scope)] += Now - StartCycles;
+
+	Current = Parent;
+	if (Parent)
+	{
+		Parent->StartCycles = Now;
+	}
+}
+
+void FAccelByteWarsFrameScopeTimer::ResetFrame()
+{
+	FMemory::Memzero(FrameCycles);
+}
+
+const TCHAR* FAccelByteWarsFrameScopeTimer::GetScopeName(const EAccelByteWarsFrameScope Scope)
+{
+	switch (Scope)
+	{
+	case EAccelByteWarsFrameScope::MissileForces:
+		return TEXT("MissileForces");
+	case EAccelByteWarsFrameScope::MissileIntegrate:
+		return TEXT("MissileIntegrate");
+	case EAccelByteWarsFrameScope::MissileLifetime:
+		return TEXT("MissileLifetime");
+	case EAccelByteWarsFrameScope::GameModeTick:
+		return TEXT("GameModeTick");
+	case EAccelByteWarsFrameScope::GameStatus:
+		return TEXT("GameStatus");
+	case EAccelByteWarsFrameScope::PowerUps:
+		return TEXT("PowerUps");
+	case EAccelByteWarsFrameScope::Spawning:
+		return TEXT("Spawning");
+	case EAccelByteWarsFrameScope::Replication:
+		return TEXT("Replication");
+	default:
+		return TEXT("Unknown");
+	}
+}
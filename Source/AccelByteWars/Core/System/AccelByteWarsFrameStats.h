@@ -0,0 +1,78 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("AccelByteWars"), STATGROUP_AccelByteWars, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Missile forces"), STAT_AccelByteWars_MissileForces, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Missile integrate"), STAT_AccelByteWars_MissileIntegrate, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Missile lifetime"), STAT_AccelByteWars_MissileLifetime, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Game mode tick"), STAT_AccelByteWars_GameModeTick, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Game status"), STAT_AccelByteWars_GameStatus, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Power ups"), STAT_AccelByteWars_PowerUps, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawning"), STAT_AccelByteWars_Spawning, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Replication"), STAT_AccelByteWars_Replication, STATGROUP_AccelByteWars, ACCELBYTEWARS_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ACCELBYTEWARS_API, AccelByteWars);
+
+/**
+ * @brief Game thread work measured per frame by UAccelByteWarsFrameBudgetSubsystem, one per ACCELBYTEWARS_FRAME_SCOPE name
+ */
+enum class EAccelByteWarsFrameScope : uint8
+{
+	MissileForces,
+	MissileIntegrate,
+	MissileLifetime,
+	GameModeTick,
+	GameStatus,
+	PowerUps,
+	Spawning,
+	Replication,
+	Num
+};
+
+/**
+ * @brief Exclusive game thread time of each frame scope: a nested scope pauses its parent, so the scopes add up to the
+ * instrumented time without counting anything twice
+ */
+class ACCELBYTEWARS_API FAccelByteWarsFrameScopeTimer
+{
+public:
+	explicit FAccelByteWarsFrameScopeTimer(const EAccelByteWarsFrameScope InScope);
+	~FAccelByteWarsFrameScopeTimer();
+
+	/**
+	 * @brief Cycles spent in Scope since the last ResetFrame
+	 */
+	static uint64 GetFrameCycles(const EAccelByteWarsFrameScope Scope) { return FrameCycles[static_cast<int32>(Scope)]; }
+
+	static void ResetFrame();
+
+	static const TCHAR* GetScopeName(const EAccelByteWarsFrameScope Scope);
+
+private:
+	EAccelByteWarsFrameScope Scope;
+	FAccelByteWarsFrameScopeTimer* Parent = nullptr;
+	uint64 StartCycles = 0;
+
+	// game thread only
+	static FAccelByteWarsFrameScopeTimer* Current;
+	static uint64 FrameCycles[static_cast<int32>(EAccelByteWarsFrameScope::Num)];
+};
+
+/**
+ * @brief Time the rest of the block as Name in stat AccelByteWars, the CSV profiler, Unreal Insights and the frame budget
+ * @param Name One of EAccelByteWarsFrameScope
+ */
+#define ACCELBYTEWARS_FRAME_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_AccelByteWars_##Name); \
+	CSV_SCOPED_TIMING_STAT(AccelByteWars, Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(AccelByteWars_##Name); \
+	const FAccelByteWarsFrameScopeTimer AccelByteWarsFrameScopeTimer_##Name(EAccelByteWarsFrameScope::Name)
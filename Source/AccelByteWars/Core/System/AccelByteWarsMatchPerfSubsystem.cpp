@@ -0,0 +1,222 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsMatchPerfSubsystem.h"
+
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Dom/JsonObject.h"
+#include "Engine/NetDriver.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteWarsMatchPerf);
+
+#pragma region "Recorder"
+FAccelByteWarsMatchPerfRecorder::~FAccelByteWarsMatchPerfRecorder()
+{
+	Stop();
+}
+
+void FAccelByteWarsMatchPerfRecorder::Start(UWorld* World)
+{
+	Stop();
+
+	RecordedWorld = World;
+	ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateRaw(this, &FAccelByteWarsMatchPerfRecorder::OnActorSpawned));
+	PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddRaw(this, &FAccelByteWarsMatchPerfRecorder::OnPreGarbageCollect);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FAccelByteWarsMatchPerfRecorder::OnPostGarbageCollect);
+}
+
+void FAccelByteWarsMatchPerfRecorder::Stop()
+{
+	if (UWorld* World = RecordedWorld.Get())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	RecordedWorld.Reset();
+
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	ActorSpawnedHandle.Reset();
+	PreGarbageCollectHandle.Reset();
+	PostGarbageCollectHandle.Reset();
+}
+
+void FAccelByteWarsMatchPerfRecorder::AddFrame(const float DeltaSeconds, const double FrameMs, const double GameThreadMs, const UNetDriver* NetDriver)
+{
+	MatchSeconds += DeltaSeconds;
+	FrameTimesMs.Add(FrameMs);
+	GameThreadTimesMs.Add(GameThreadMs);
+
+	UsedPhysicalHighWaterMark = FMath::Max(UsedPhysicalHighWaterMark, static_cast<uint64>(FPlatformMemory::GetStats().UsedPhysical));
+
+	// Bytes sent to every connection, listen and dedicated servers only
+	if (NetDriver != nullptr)
+	{
+		if (NetBytesSentBaseline == INDEX_NONE)
+		{
+			NetBytesSentBaseline = NetDriver->OutTotalBytes;
+		}
+		NetBytesSent = NetDriver->OutTotalBytes - NetBytesSentBaseline;
+	}
+}
+
+bool FAccelByteWarsMatchPerfRecorder::WriteReport(const FString& Path, const FString& MapName, const TMap<FString, double>& ExtraFields) const
+{
+	TArray<float> SortedFrameTimesMs = FrameTimesMs;
+	SortedFrameTimesMs.Sort();
+	TArray<float> SortedGameThreadTimesMs = GameThreadTimesMs;
+	SortedGameThreadTimesMs.Sort();
+
+	const auto MakePercentiles = [](const TArray<float>& SortedSamples)
+	{
+		TSharedRef<FJsonObject> Percentiles = MakeShared<FJsonObject>();
+		Percentiles->SetNumberField(TEXT("p50"), GetPercentile(SortedSamples, 0.5f));
+		Percentiles->SetNumberField(TEXT("p90"), GetPercentile(SortedSamples, 0.9f));
+		Percentiles->SetNumberField(TEXT("p99"), GetPercentile(SortedSamples, 0.99f));
+		Percentiles->SetNumberField(TEXT("max"), SortedSamples.IsEmpty() ? 0.0f : SortedSamples.Last());
+		return Percentiles;
+	};
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("map"), MapName);
+	Report->SetNumberField(TEXT("frames"), FrameTimesMs.Num());
+	Report->SetNumberField(TEXT("match_seconds"), MatchSeconds);
+	Report->SetObjectField(TEXT("frame_time_ms"), MakePercentiles(SortedFrameTimesMs));
+	Report->SetObjectField(TEXT("game_thread_time_ms"), MakePercentiles(SortedGameThreadTimesMs));
+	Report->SetNumberField(TEXT("actors_spawned"), NumActorsSpawned);
+	Report->SetNumberField(TEXT("spawns_per_second"), NumActorsSpawned / FMath::Max(MatchSeconds, UE_KINDA_SMALL_NUMBER));
+	Report->SetNumberField(TEXT("gc_count"), NumGarbageCollections);
+	Report->SetNumberField(TEXT("gc_total_ms"), GarbageCollectSeconds * 1000.0);
+	Report->SetNumberField(TEXT("gc_max_ms"), MaxGarbageCollectSeconds * 1000.0);
+	Report->SetNumberField(TEXT("net_bytes_sent"), NetBytesSent);
+	Report->SetNumberField(TEXT("net_bytes_sent_per_second"), NetBytesSent / FMath::Max(MatchSeconds, UE_KINDA_SMALL_NUMBER));
+	Report->SetNumberField(TEXT("used_physical_high_water_mark_mb"), UsedPhysicalHighWaterMark / (1024.0 * 1024.0));
+	Report->SetNumberField(TEXT("peak_used_physical_mb"), MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0));
+
+	for (const TPair<FString, double>& Field : ExtraFields)
+	{
+		Report->SetNumberField(Field.Key, Field.Value);
+	}
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	if (!FFileHelper::SaveStringToFile(ReportString, *Path))
+	{
+		MATCHPERF_LOG(Warning, TEXT("Failed to write match perf report to %s"), *Path);
+		return false;
+	}
+
+	MATCHPERF_LOG(Log, TEXT("Match perf report written to %s"), *Path);
+	return true;
+}
+
+float FAccelByteWarsMatchPerfRecorder::GetPercentile(const TArray<float>& SortedSamples, const float Percentile)
+{
+	if (SortedSamples.IsEmpty())
+	{
+		return 0.0f;
+	}
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+	return SortedSamples[Index];
+}
+
+void FAccelByteWarsMatchPerfRecorder::OnActorSpawned(AActor* Actor)
+{
+	NumActorsSpawned++;
+}
+
+void FAccelByteWarsMatchPerfRecorder::OnPreGarbageCollect()
+{
+	GarbageCollectStartTime = FPlatformTime::Seconds();
+}
+
+void FAccelByteWarsMatchPerfRecorder::OnPostGarbageCollect()
+{
+	const double Seconds = FPlatformTime::Seconds() - GarbageCollectStartTime;
+	GarbageCollectSeconds += Seconds;
+	MaxGarbageCollectSeconds = FMath::Max(MaxGarbageCollectSeconds, Seconds);
+	NumGarbageCollections++;
+}
+#pragma endregion
+
+bool UAccelByteWarsMatchPerfSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	FString Path;
+	return GetReportPath(Path) && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAccelByteWarsMatchPerfSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	GetReportPath(ReportPath);
+
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &ThisClass::OnWorldTickStart);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &ThisClass::OnEndFrame);
+}
+
+void UAccelByteWarsMatchPerfSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+
+	Recorder.Stop();
+
+	// Worlds without a match (e.g. main menu) have nothing to report
+	if (!Recorder.IsEmpty())
+	{
+		Recorder.WriteReport(ReportPath, GetWorld()->GetMapName());
+	}
+
+	Super::Deinitialize();
+}
+
+bool UAccelByteWarsMatchPerfSubsystem::GetReportPath(FString& OutPath)
+{
+	return FParse::Value(FCommandLine::Get(), TEXT("-MatchPerfReport="), OutPath) && !OutPath.IsEmpty();
+}
+
+void UAccelByteWarsMatchPerfSubsystem::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// The match starts with the in-game game state, clients or not
+	if (World->GetGameState<AAccelByteWarsInGameGameState>() == nullptr)
+	{
+		FrameStartCycles = 0;
+		return;
+	}
+
+	if (!Recorder.IsStarted())
+	{
+		Recorder.Start(World);
+	}
+
+	FrameStartCycles = FPlatformTime::Cycles64();
+	FrameDeltaSeconds = DeltaTime;
+}
+
+void UAccelByteWarsMatchPerfSubsystem::OnEndFrame()
+{
+	if (FrameStartCycles == 0)
+	{
+		return;
+	}
+
+	const double FrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles);
+	FrameStartCycles = 0;
+
+	Recorder.AddFrame(FrameDeltaSeconds, FrameMs, FPlatformTime::ToMilliseconds(GGameThreadTime), GetWorld()->GetNetDriver());
+}
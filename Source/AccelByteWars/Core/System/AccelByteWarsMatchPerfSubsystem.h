@@ -0,0 +1,132 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AccelByteWarsMatchPerfSubsystem.generated.h"
+
+class UNetDriver;
+
+ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsMatchPerf, Log, All);
+
+#define MATCHPERF_LOG(Verbosity, Format, ...) \
+{ \
+	UE_LOG(LogAccelByteWarsMatchPerf, Verbosity, TEXT("%s"), *FString::Printf(Format, ##__VA_ARGS__)); \
+}
+
+/**
+ * Frame times, spawns, garbage collections, memory and net traffic of a match, written as JSON.
+ * Shared by UAccelByteWarsMatchPerfSubsystem and the headless match automation test so that both write the same report.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsMatchPerfRecorder
+{
+public:
+	~FAccelByteWarsMatchPerfRecorder();
+
+	/**
+	 * @brief Count the actors spawned in World and the garbage collections from now on
+	 */
+	void Start(UWorld* World);
+	void Stop();
+
+	/**
+	 * @brief Record one frame
+	 * @param DeltaSeconds Game time of the frame
+	 * @param FrameMs Wall time of the frame, measured with FPlatformTime around the world tick
+	 * @param GameThreadMs Game thread time of the frame, FrameMs if the engine loop doesn't run
+	 * @param NetDriver Net driver of the world, nullptr without networking
+	 */
+	void AddFrame(const float DeltaSeconds, const double FrameMs, const double GameThreadMs, const UNetDriver* NetDriver);
+
+	bool IsStarted() const { return RecordedWorld.IsValid(); }
+	bool IsEmpty() const { return FrameTimesMs.IsEmpty(); }
+	int32 GetNumActorsSpawned() const { return NumActorsSpawned; }
+
+	/**
+	 * @brief Write the report of every frame recorded so far, logs where it went
+	 * @param ExtraFields Added to the top level object, e.g. the setup of a scripted match
+	 */
+	bool WriteReport(const FString& Path, const FString& MapName, const TMap<FString, double>& ExtraFields = {}) const;
+
+	/**
+	 * @brief Value at Percentile (0..1) of the sorted samples
+	 */
+	static float GetPercentile(const TArray<float>& SortedSamples, const float Percentile);
+
+private:
+	void OnActorSpawned(AActor* Actor);
+	void OnPreGarbageCollect();
+	void OnPostGarbageCollect();
+
+	TWeakObjectPtr<UWorld> RecordedWorld;
+
+	TArray<float> FrameTimesMs;
+	TArray<float> GameThreadTimesMs;
+
+	double MatchSeconds = 0.0;
+	int32 NumActorsSpawned = 0;
+
+	int32 NumGarbageCollections = 0;
+	double GarbageCollectSeconds = 0.0;
+	double MaxGarbageCollectSeconds = 0.0;
+	double GarbageCollectStartTime = 0.0;
+
+	uint64 UsedPhysicalHighWaterMark = 0;
+
+	/**
+	 * @brief Net driver out bytes of the first frame with a net driver, INDEX_NONE until then
+	 */
+	int64 NetBytesSentBaseline = INDEX_NONE;
+	int64 NetBytesSent = 0;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle PreGarbageCollectHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+};
+
+/**
+ * Records the performance of a match and writes it as JSON when the world ends.
+ * Only created when the process runs with -MatchPerfReport=<file>, e.g. a headless server:
+ * AccelByteWarsServer -nullrhi -MatchPerfReport=Saved/Perf/Match.json -MatchRandomSeed=42
+ * Every frame of a world with an in-game game state is recorded, whatever the game status, so a server that no client
+ * joined is measured too. A frame lasts from the world tick start to the end of the engine frame, like in
+ * UAccelByteWarsFrameBudgetSubsystem. For a repeatable run without clients or networking, see AccelByteWars.Perf.HeadlessMatch.
+ */
+UCLASS()
+class ACCELBYTEWARS_API UAccelByteWarsMatchPerfSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~UWorldSubsystem overridden functions
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of UWorldSubsystem overridden functions
+
+	/**
+	 * @brief Report file from the command line
+	 * @return false if -MatchPerfReport is not set
+	 */
+	static bool GetReportPath(FString& OutPath);
+
+private:
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaTime);
+	void OnEndFrame();
+
+	FString ReportPath;
+
+	FAccelByteWarsMatchPerfRecorder Recorder;
+
+	/**
+	 * @brief Cycles when this world started ticking, 0 if the current frame is not recorded
+	 */
+	uint64 FrameStartCycles = 0;
+	float FrameDeltaSeconds = 0.0f;
+
+	FDelegateHandle WorldTickStartHandle;
+	FDelegateHandle EndFrameHandle;
+};
@@ -0,0 +1,220 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsMissileSubsystem.h"
+
+#include "Core/Actor/AccelByteWarsMissile.h"
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Core/System/AccelByteWarsFrameStats.h"
+
+int32 FAccelByteWarsFixedStepClock::Advance(const double DeltaSeconds, const double StepSeconds, const int32 MaxSteps)
+{
+	Accumulator += DeltaSeconds;
+
+	int32 NumSteps = 0;
+	while (Accumulator >= StepSeconds && NumSteps < MaxSteps)
+	{
+		Accumulator -= StepSeconds;
+		NumSteps++;
+	}
+
+	// A hitch, drop the time that is left instead of catching up over the next frames
+	if (NumSteps == MaxSteps)
+	{
+		Accumulator = 0.0;
+	}
+
+	return NumSteps;
+}
+
+void UAccelByteWarsMissileSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Missiles.IsEmpty())
+	{
+		return;
+	}
+
+	AAccelByteWarsInGameGameState* ABGameState = GetWorld()->GetGameState<AAccelByteWarsInGameGameState>();
+	if (ABGameState == nullptr)
+	{
+		return;
+	}
+
+	// Consume the frame time in fixed size substeps
+	const float StepSeconds = FMath::Max(FixedStepSeconds, KINDA_SMALL_NUMBER);
+	const int32 NumSteps = StepClock.Advance(DeltaTime, StepSeconds, MaxSubstepsPerFrame);
+
+	bIsStepping = true;
+
+	// Missiles registered during the step (e.g. spawned by a kill) start moving on the next frame
+	const int32 NumMissiles = Missiles.Num();
+
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		StepMissiles(ABGameState, StepSeconds, NumMissiles);
+	}
+
+	// Mirror to actors and run the lifetime rules, this may destroy missiles
+	{
+		ACCELBYTEWARS_FRAME_SCOPE(MissileLifetime);
+		for (int32 i = 0; i < NumMissiles; ++i)
+		{
+			AAccelByteWarsMissile* Missile = Missiles[i];
+			if (Missile == nullptr)
+				continue;
+
+			// Clients converge on the server's location, the simulation carries on from the corrected location
+			if (!Missile->HasAuthority())
+			{
+				Positions[i] += Missile->ConsumeNetLocationError(DeltaTime);
+			}
+
+			Missile->ApplySimulationResult(Positions[i], Velocities[i], GravityForces[i]);
+			Missile->TickLifetime(DeltaTime);
+		}
+	}
+
+	bIsStepping = false;
+	CompactPendingRemovals();
+}
+
+void UAccelByteWarsMissileSubsystem::StepMissiles(AAccelByteWarsInGameGameState* ABGameState, const float StepSeconds, const int32 NumMissiles)
+{
+	// Forces and hit detection at the pre-step location
+	{
+		ACCELBYTEWARS_FRAME_SCOPE(MissileForces);
+		for (int32 i = 0; i < NumMissiles; ++i)
+		{
+			AAccelByteWarsMissile* Missile = Missiles[i];
+			if (Missile == nullptr || HasHit[i])
+				continue;
+
+			GravityForces[i] = AAccelByteWarsMissile::CalculateGravityForce(ABGameState, Positions[i], Masses[i], GravitationalConstants[i]);
+
+			// A missile that hit something stays at the impact point until it is destroyed
+			Missile->DetectHitObjectsAt(Positions[i]);
+			HasHit[i] = Missile->HitObject != nullptr;
+		}
+	}
+
+	// Integrate, contiguous and actor free
+	{
+		ACCELBYTEWARS_FRAME_SCOPE(MissileIntegrate);
+		for (int32 i = 0; i < NumMissiles; ++i)
+		{
+			if (HasHit[i])
+				continue;
+
+			Velocities[i] = Velocities[i] + ((GravityForces[i] / Masses[i]) * StepSeconds);
+			Positions[i] = Positions[i] + (StepSeconds * Velocities[i]);
+		}
+	}
+}
+
+TStatId UAccelByteWarsMissileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAccelByteWarsMissileSubsystem, STATGROUP_Tickables);
+}
+
+void UAccelByteWarsMissileSubsystem::Deinitialize()
+{
+	for (AAccelByteWarsMissile* Missile : Missiles)
+	{
+		if (Missile != nullptr)
+			Missile->SimulationIndex = INDEX_NONE;
+	}
+
+	Missiles.Empty();
+	Positions.Empty();
+	Velocities.Empty();
+	GravityForces.Empty();
+	Masses.Empty();
+	GravitationalConstants.Empty();
+	HasHit.Empty();
+	PendingRemovals.Empty();
+	StepClock.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAccelByteWarsMissileSubsystem::RegisterMissile(AAccelByteWarsMissile* Missile)
+{
+	if (Missile == nullptr || Missile->SimulationIndex != INDEX_NONE)
+		return;
+
+	if (Missile->AccelByteWarsGameplayObjectComponent == nullptr)
+		return;
+
+	Missile->SimulationIndex = Missiles.Add(Missile);
+	Positions.Add(Missile->GetActorLocation());
+	Velocities.Add(Missile->Velocity);
+	GravityForces.Add(Missile->GravityForce);
+	Masses.Add(Missile->AccelByteWarsGameplayObjectComponent->Mass);
+	GravitationalConstants.Add(Missile->GravitationalConstant);
+	HasHit.Add(false);
+}
+
+void UAccelByteWarsMissileSubsystem::UnregisterMissile(AAccelByteWarsMissile* Missile)
+{
+	if (Missile == nullptr || !Missiles.IsValidIndex(Missile->SimulationIndex))
+		return;
+
+	const int32 Index = Missile->SimulationIndex;
+	Missile->SimulationIndex = INDEX_NONE;
+
+	// Keep indices stable while stepping
+	if (bIsStepping)
+	{
+		Missiles[Index] = nullptr;
+		PendingRemovals.Add(Index);
+		return;
+	}
+
+	Missiles.RemoveAtSwap(Index, 1, false);
+	Positions.RemoveAtSwap(Index, 1, false);
+	Velocities.RemoveAtSwap(Index, 1, false);
+	GravityForces.RemoveAtSwap(Index, 1, false);
+	Masses.RemoveAtSwap(Index, 1, false);
+	GravitationalConstants.RemoveAtSwap(Index, 1, false);
+	HasHit.RemoveAtSwap(Index, 1, false);
+
+	if (Missiles.IsValidIndex(Index) && Missiles[Index] != nullptr)
+	{
+		Missiles[Index]->SimulationIndex = Index;
+	}
+}
+
+void UAccelByteWarsMissileSubsystem::SyncMissileState(const AAccelByteWarsMissile* Missile)
+{
+	if (Missile == nullptr || !Missiles.IsValidIndex(Missile->SimulationIndex))
+		return;
+
+	Positions[Missile->SimulationIndex] = Missile->GetActorLocation();
+	Velocities[Missile->SimulationIndex] = Missile->Velocity;
+	HasHit[Missile->SimulationIndex] = Missile->HitObject != nullptr;
+}
+
+void UAccelByteWarsMissileSubsystem::CompactPendingRemovals()
+{
+	// Highest index first so that swapped-in entries are never pending themselves
+	PendingRemovals.Sort(TGreater<int32>());
+	for (const int32 Index : PendingRemovals)
+	{
+		Missiles.RemoveAtSwap(Index, 1, false);
+		Positions.RemoveAtSwap(Index, 1, false);
+		Velocities.RemoveAtSwap(Index, 1, false);
+		GravityForces.RemoveAtSwap(Index, 1, false);
+		Masses.RemoveAtSwap(Index, 1, false);
+		GravitationalConstants.RemoveAtSwap(Index, 1, false);
+		HasHit.RemoveAtSwap(Index, 1, false);
+
+		if (Missiles.IsValidIndex(Index) && Missiles[Index] != nullptr)
+		{
+			Missiles[Index]->SimulationIndex = Index;
+		}
+	}
+	PendingRemovals.Reset();
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AccelByteWarsMissileSubsystem.generated.h"
+
+class AAccelByteWarsMissile;
+class AAccelByteWarsInGameGameState;
+
+/**
+ * @brief Turns frame times into a number of fixed size steps, the time left over carries over to the next frame
+ */
+struct ACCELBYTEWARS_API FAccelByteWarsFixedStepClock
+{
+	/**
+	 * @brief Add a frame's time
+	 * @param MaxSteps Steps allowed in a single frame, the time left over is dropped when it is reached
+	 * @return Steps to run for this frame
+	 */
+	int32 Advance(const double DeltaSeconds, const double StepSeconds, const int32 MaxSteps);
+
+	void Reset() { Accumulator = 0.0; }
+
+	/**
+	 * @brief Frame time not yet consumed by a step
+	 */
+	double Accumulator = 0.0;
+};
+
+/**
+ * Owns the flight state of every live missile in the world and advances all of them in one pass per frame.
+ * Missile actors do not tick, they only mirror the results of the step.
+ *
+ * Missiles are advanced in fixed size substeps (semi-implicit Euler: velocity first, then position with the new
+ * velocity), hit detection runs on every substep. Trajectories and impact points only depend on the substep size,
+ * not on the server tick rate. Per substep, the operations match the former per-actor Missile Tick.
+ *
+ * Clients run the same simulation between updates, and the server's replicated location pulls it back over
+ * NetCorrectionSeconds instead of being overwritten by it.
+ */
+UCLASS(config = Game)
+class ACCELBYTEWARS_API UAccelByteWarsMissileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~UTickableWorldSubsystem overridden functions
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+	//~End of UTickableWorldSubsystem overridden functions
+
+	/**
+	 * @brief Start simulating the missile from its current location and velocity
+	 */
+	void RegisterMissile(AAccelByteWarsMissile* Missile);
+
+	/**
+	 * @brief Stop simulating the missile. Safe to call during the step.
+	 */
+	void UnregisterMissile(AAccelByteWarsMissile* Missile);
+
+	/**
+	 * @brief Overwrite the simulated location and velocity with the missile actor's current values
+	 */
+	void SyncMissileState(const AAccelByteWarsMissile* Missile);
+
+	int32 GetNumMissiles() const { return Missiles.Num(); }
+
+	/**
+	 * @brief Simulation step size in seconds, independent of the frame rate
+	 */
+	UPROPERTY(config)
+	float FixedStepSeconds = 1.0f / 120.0f;
+
+	/**
+	 * @brief Substeps allowed in a single frame. Time beyond that is dropped to avoid a spiral of death on a hitch.
+	 */
+	UPROPERTY(config)
+	int32 MaxSubstepsPerFrame = 16;
+
+private:
+	void StepMissiles(AAccelByteWarsInGameGameState* ABGameState, const float StepSeconds, const int32 NumMissiles);
+	void CompactPendingRemovals();
+
+	UPROPERTY(Transient)
+	TArray<AAccelByteWarsMissile*> Missiles;
+
+	// Structure of arrays, index i belongs to Missiles[i]
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FVector> GravityForces;
+	TArray<float> Masses;
+	TArray<float> GravitationalConstants;
+	TArray<bool> HasHit;
+
+	FAccelByteWarsFixedStepClock StepClock;
+
+	/**
+	 * @brief Missiles unregistered during the step, removed once the step is done
+	 */
+	TArray<int32> PendingRemovals;
+
+	bool bIsStepping = false;
+};
@@ -0,0 +1,41 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "AccelByteWarsPoolableActorInterface.generated.h"
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UAccelByteWarsPoolableActorInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Actors implementing this interface are recycled by UAccelByteWarsActorPoolSubsystem instead of being destroyed.
+ * BeginPlay only runs once per instance, per use initialization belongs in OnAcquiredFromPool.
+ */
+class ACCELBYTEWARS_API IAccelByteWarsPoolableActorInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Called when a pooled instance is handed out again. Owner, instigator and transform are already set.
+	 */
+	virtual void OnAcquiredFromPool() = 0;
+
+	/**
+	 * @brief Called when the instance goes back to the pool. Stop everything that would keep running while idle.
+	 */
+	virtual void OnReleasedToPool() = 0;
+
+	/**
+	 * @brief Called instead of the owner's OnDestroyed when the owner goes back to the pool, on the server and on clients.
+	 * The binding to the owner's OnDestroyed is already removed.
+	 */
+	virtual void OnOwnerReleasedToPool(AActor* Owner) {}
+};
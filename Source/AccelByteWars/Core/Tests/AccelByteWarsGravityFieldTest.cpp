@@ -0,0 +1,123 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/SceneComponent.h"
+#include "Core/Actor/AccelByteWarsMissile.h"
+#include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
+#include "Core/GameStates/AccelByteWarsGravityField.h"
+#include "Core/Tests/AccelByteWarsTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteWarsGravityFieldAccuracyTest, "AccelByteWars.GameState.GravityFieldAccuracy",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Samples the field of two planets on rings from their surface to a few cells away, and at a few far points.
+ * Every sample must stay within the bilinear error bound documented on FAccelByteWarsGravityField of the exact pull.
+ */
+bool FAccelByteWarsGravityFieldAccuracyTest::RunTest(const FString& Parameters)
+{
+	constexpr float CellSize = 25.0f;
+	constexpr int32 NumBearings = 64;
+	constexpr int32 NumRingsPerCell = 4;
+	constexpr int32 NumCells = 4;
+
+	const FAccelByteWarsTestWorld World;
+
+	TArray<UAccelByteWarsGameplayObjectComponent*> Bodies;
+	const auto AddPlanet = [&World, &Bodies](const FVector& Location, const float Mass, const float Radius)
+	{
+		AActor* Planet = World->SpawnActor<AActor>();
+		USceneComponent* PlanetRoot = NewObject<USceneComponent>(Planet);
+		Planet->SetRootComponent(PlanetRoot);
+		PlanetRoot->RegisterComponent();
+		Planet->SetActorLocation(Location);
+
+		UAccelByteWarsGameplayObjectComponent* Body = NewObject<UAccelByteWarsGameplayObjectComponent>(Planet);
+		Body->ObjectType = EGameplayObjectType::PLANET;
+		Body->Mass = Mass;
+		Body->Radius = Radius;
+		Bodies.Add(Body);
+	};
+	AddPlanet(FVector::ZeroVector, 50000.0f, 1.5f);
+	AddPlanet(FVector(900.0f, 300.0f, 0.0f), 120000.0f, 3.0f);
+
+	FAccelByteWarsGravityField Field;
+	Field.Rebuild(Bodies, FVector2D(-2000.0f), FVector2D(2000.0f), CellSize);
+
+	// Sum over the bodies of the documented bound, relative bounds are turned into forces with each body's own pull
+	const auto GetErrorBound = [&Bodies, CellSize](const FVector& Location)
+	{
+		float Bound = 0.0f;
+		for (const UAccelByteWarsGameplayObjectComponent* Body : Bodies)
+		{
+			const float a = Body->Mass * 50.0f;
+			const float Radius = Body->Radius * 100.0f;
+			const float NearestSampleDistance = FVector::Dist2D(Body->GetOwner()->GetActorLocation(), Location) - CellSize * UE_SQRT_2;
+			if (NearestSampleDistance >= Radius)
+			{
+				Bound += 0.85f * FMath::Square(CellSize / NearestSampleDistance) * a / FMath::Pow(NearestSampleDistance, 1.5f);
+			}
+			else
+			{
+				Bound += CellSize / Radius * a / FMath::Pow(Radius, 1.5f);
+			}
+		}
+		return Bound;
+	};
+
+	float MaxRelativeError = 0.0f;
+	const auto TestLocation = [this, &Field, &Bodies, &GetErrorBound, &MaxRelativeError](const FVector& Location)
+	{
+		FVector Sampled = FVector::ZeroVector;
+		if (!TestTrue(FString::Printf(TEXT("%s is inside of the field"), *Location.ToString()), Field.Sample(Location, Sampled)))
+		{
+			return;
+		}
+
+		// unit mass and gravitational constant, what the field holds
+		FVector Exact = FVector::ZeroVector;
+		for (const UAccelByteWarsGameplayObjectComponent* Body : Bodies)
+		{
+			float Distance = 0.0f;
+			FVector Force = FVector::ZeroVector;
+			AAccelByteWarsMissile::CalculateGravityForceToObject(Location, 1.0f, 1.0f, Body, Distance, Force);
+			Exact += Force;
+		}
+
+		const float Error = FVector::Dist(Sampled, Exact);
+		MaxRelativeError = FMath::Max(MaxRelativeError, Error / FMath::Max(Exact.Size(), UE_KINDA_SMALL_NUMBER));
+		TestTrue(FString::Printf(TEXT("Field at %s is off by %f, bound %f"), *Location.ToString(), Error, GetErrorBound(Location)),
+			Error <= GetErrorBound(Location));
+	};
+
+	for (const UAccelByteWarsGameplayObjectComponent* Body : Bodies)
+	{
+		const FVector BodyLocation = Body->GetOwner()->GetActorLocation();
+		const float Radius = Body->Radius * 100.0f;
+		for (int32 Ring = 0; Ring <= NumRingsPerCell * NumCells; ++Ring)
+		{
+			const float Distance = Radius + Ring * CellSize / NumRingsPerCell;
+			for (int32 i = 0; i < NumBearings; ++i)
+			{
+				TestLocation(BodyLocation + FRotator(0.0f, 360.0f * i / NumBearings, 0.0f).Vector() * Distance);
+			}
+		}
+	}
+
+	for (const FVector& Location : {FVector(-1800.0f, 1500.0f, 0.0f), FVector(1500.0f, -1200.0f, 0.0f), FVector(450.0f, 150.0f, 0.0f)})
+	{
+		TestLocation(Location);
+	}
+
+	AddInfo(FString::Printf(TEXT("Max relative error %f with %.0f unit cells"), MaxRelativeError, CellSize));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
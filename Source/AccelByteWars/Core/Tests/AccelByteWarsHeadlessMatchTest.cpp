@@ -0,0 +1,433 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/GameModes/AccelByteWarsInGameGameMode.h"
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Core/Player/AccelByteWarsPlayerPawn.h"
+#include "Core/System/AccelByteWarsAllocationCounter.h"
+#include "Core/System/AccelByteWarsMatchPerfSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+
+/**
+ * A local match on the in-game map with one scripted player per local player, no clients, no networking and no rendering.
+ * The game mode runs it like a local game: the players log in and get a team, the game status goes from awaiting players
+ * through the pre-game countdown to the match, ships die and respawn, and the match ends on time out or elimination.
+ * The engine runs at a fixed time step, every frame from the world tick start to the end of the engine frame is timed
+ * like in UAccelByteWarsMatchPerfSubsystem.
+ */
+class FAccelByteWarsHeadlessMatch
+{
+public:
+	FAccelByteWarsHeadlessMatch(
+		FAutomationTestBase& InTest,
+		const int32 InNumBots,
+		const int32 InRandomSeed,
+		const int32 InTickRate,
+		const float InMatchSeconds,
+		const FString& InReportPath)
+		: Test(InTest)
+		, NumBots(InNumBots)
+		, RandomSeed(InRandomSeed)
+		, TickRate(InTickRate)
+		, MatchSeconds(InMatchSeconds)
+		, ReportPath(InReportPath)
+		, Random(InRandomSeed)
+		, MapLoadStartTime(FPlatformTime::Seconds())
+	{
+		bSavedUseFixedTimeStep = FApp::UseFixedTimeStep();
+		SavedFixedDeltaTime = FApp::GetFixedDeltaTime();
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(1.0 / TickRate);
+
+		WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(this, &FAccelByteWarsHeadlessMatch::OnWorldTickStart);
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FAccelByteWarsHeadlessMatch::OnEndFrame);
+		PlayerDieHandle = AAccelByteWarsInGameGameMode::OnPlayerDieDelegate.AddRaw(this, &FAccelByteWarsHeadlessMatch::OnPlayerDie);
+	}
+
+	~FAccelByteWarsHeadlessMatch()
+	{
+		FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		AAccelByteWarsInGameGameMode::OnPlayerDieDelegate.Remove(PlayerDieHandle);
+		if (UWorld* MatchWorld = World.Get())
+		{
+			MatchWorld->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		}
+
+		FApp::SetUseFixedTimeStep(bSavedUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(SavedFixedDeltaTime);
+	}
+
+	/**
+	 * @brief Play one engine frame of the match, called by the latent command once the map is loaded
+	 * @return true once the match ended or can't go on
+	 */
+	bool Update()
+	{
+		if (!bSetUp)
+		{
+			// the map opens on a later frame than the open command
+			if (!FindMatch())
+			{
+				const bool bTimedOut = FPlatformTime::Seconds() - MapLoadStartTime > MapLoadTimeout;
+				if (bTimedOut)
+				{
+					Test.AddError(TEXT("The in-game map didn't load an in-game match with authority"));
+				}
+				return bTimedOut;
+			}
+			bSetUp = true;
+			return !Setup();
+		}
+
+		const AAccelByteWarsInGameGameState* GameState = World.IsValid() ? World->GetGameState<AAccelByteWarsInGameGameState>() : nullptr;
+		if (!GameMode.IsValid() || GameState == nullptr)
+		{
+			Test.AddError(TEXT("The match world went away before the match ended"));
+			Finish();
+			return true;
+		}
+
+		switch (GameState->GameStatus)
+		{
+		case EGameStatus::GAME_STARTED:
+			if (!bMatchStarted)
+			{
+				StartMatch();
+			}
+			FirePlayers();
+			if (MatchSeconds > 0.0f && World->GetTimeSeconds() - MatchStartTime >= MatchSeconds)
+			{
+				GameMode->EndGame(TEXT("Headless match perf run over"));
+			}
+			break;
+		case EGameStatus::GAME_ENDS:
+			bMatchEnded = true;
+			Finish();
+			return true;
+		default:
+			break;
+		}
+
+		if (World->GetTimeSeconds() > TimeLimit)
+		{
+			Test.AddError(FString::Printf(TEXT("Match not over after %.0f s, game status %d"), TimeLimit, static_cast<int32>(GameState->GameStatus)));
+			Finish();
+			return true;
+		}
+		return false;
+	}
+
+private:
+	static constexpr float MinFireInterval = 0.5f;
+	static constexpr float MaxFireInterval = 3.0f;
+
+	/**
+	 * @brief Game time past the pre-game countdown and the match length for gameplay classes to load and the match to end
+	 */
+	static constexpr float TimeLimitSlack = 300.0f;
+	static constexpr double MapLoadTimeout = 120.0;
+
+	struct FPlayer
+	{
+		TWeakObjectPtr<APlayerController> Controller;
+		float NextFireTime = 0.0f;
+	};
+
+	/**
+	 * @brief Whether the game world runs an in-game match with authority that began play
+	 */
+	bool FindMatch()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if (Context.WorldType == EWorldType::Game && Context.World() != nullptr)
+			{
+				World = Context.World();
+				break;
+			}
+		}
+
+		GameMode = World.IsValid() ? Cast<AAccelByteWarsInGameGameMode>(World->GetAuthGameMode()) : nullptr;
+		return GameMode.IsValid() && World->GetGameState<AAccelByteWarsInGameGameState>() != nullptr && World->HasBegunPlay();
+	}
+
+	/**
+	 * @brief Add the local players of the scripted players to the match the map was loaded with
+	 */
+	bool Setup()
+	{
+		const AAccelByteWarsInGameGameState* GameState = World->GetGameState<AAccelByteWarsInGameGameState>();
+
+		// over the game mode's player limit the players get kicked, over the splitscreen limit they aren't created at all
+		const UGameViewportClient* GameViewport = World->GetGameViewport();
+		const int32 MaxLocalPlayers = GameViewport != nullptr ? GameViewport->MaxSplitscreenPlayers : 1;
+		const int32 NumPlayers = FMath::Min3(NumBots, GameState->GameSetup.MaxPlayers, MaxLocalPlayers);
+		if (NumPlayers < NumBots)
+		{
+			Test.AddWarning(FString::Printf(TEXT("%d players instead of %d, the game mode or the local player limit"), NumPlayers, NumBots));
+		}
+
+		// the first local player came with the map, the others log in like in a local game
+		for (int32 ControllerId = 1; ControllerId < NumPlayers; ++ControllerId)
+		{
+			UGameplayStatics::CreatePlayer(World.Get(), ControllerId, true);
+		}
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			Players.Add({*Iterator, 0.0f});
+		}
+
+		ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateRaw(this, &FAccelByteWarsHeadlessMatch::OnActorSpawned));
+
+		const float MatchLength = MatchSeconds > 0.0f ? MatchSeconds : GameState->GameSetup.MatchTime;
+		TimeLimit = World->GetTimeSeconds() + GameState->PreGameCountdown + FMath::Max(MatchLength, 0.0f) + TimeLimitSlack;
+
+		return Test.TestTrue(TEXT("Players joined the match"), Players.Num() > 0);
+	}
+
+	void StartMatch()
+	{
+		bMatchStarted = true;
+		MatchStartTime = World->GetTimeSeconds();
+
+		for (FPlayer& Player : Players)
+		{
+			Player.NextFireTime = MatchStartTime + Random.FRandRange(0.0f, MaxFireInterval);
+		}
+
+		// the spawn location grid is built on first use, every query after this one must not allocate
+		FVector2D Location2D;
+		GameMode->FindGoodSpawnLocation(Location2D);
+
+		Recorder.Start(World.Get());
+	}
+
+	/**
+	 * @brief Every living ship fires at a seeded interval, aim and power. Dead ships wait for their respawn.
+	 */
+	void FirePlayers()
+	{
+		const float Time = World->GetTimeSeconds();
+		for (FPlayer& Player : Players)
+		{
+			AAccelByteWarsPlayerPawn* Pawn = Player.Controller.IsValid() ? Cast<AAccelByteWarsPlayerPawn>(Player.Controller->GetPawn()) : nullptr;
+			if (Pawn == nullptr || Time < Player.NextFireTime)
+			{
+				continue;
+			}
+
+			Pawn->SetActorRotation(FRotator(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f));
+			Pawn->FirePowerLevel = Random.GetFraction();
+			Pawn->FiredMissile = nullptr;
+			Pawn->Server_FireMissile();
+
+			// over FiredMissilesLimit, nothing fired
+			if (Pawn->FiredMissile != nullptr)
+			{
+				NumMissilesFired++;
+			}
+			Player.NextFireTime = Time + Random.FRandRange(MinFireInterval, MaxFireInterval);
+		}
+	}
+
+	/**
+	 * @brief What a respawn or a worm hole asks of the spawn location grid, after the timed frame.
+	 * Queries that fall back to the least crowded spot are counted too.
+	 */
+	void QuerySpawnLocation()
+	{
+		const FAccelByteWarsScopedAllocationCounter AllocationCounter;
+
+		FVector2D Location2D;
+		if (!GameMode->FindGoodSpawnLocation(Location2D))
+		{
+			NumSpawnQueryFallbacks++;
+		}
+
+		NumSpawnQueryAllocations += AllocationCounter.GetNumAllocations();
+		NumSpawnQueries++;
+	}
+
+	void Finish()
+	{
+		Recorder.Stop();
+
+		Test.TestTrue(TEXT("Match started"), bMatchStarted);
+		Test.TestTrue(TEXT("Match ended"), bMatchEnded);
+		Test.TestTrue(TEXT("Players fired missiles"), NumMissilesFired > 0);
+		Test.TestTrue(TEXT("Ships were destroyed"), NumShipsDestroyed > 0);
+		Test.TestTrue(TEXT("Spawn location queries ran"), NumSpawnQueries > 0);
+		Test.TestEqual(TEXT("Heap allocations of the spawn location queries"), NumSpawnQueryAllocations, static_cast<int64>(0));
+
+		if (Recorder.IsEmpty())
+		{
+			return;
+		}
+
+		const TMap<FString, double> ExtraFields = {
+			{TEXT("bots"), static_cast<double>(Players.Num())},
+			{TEXT("random_seed"), static_cast<double>(RandomSeed)},
+			{TEXT("tick_rate"), static_cast<double>(TickRate)},
+			{TEXT("missiles_fired"), static_cast<double>(NumMissilesFired)},
+			{TEXT("ships_destroyed"), static_cast<double>(NumShipsDestroyed)},
+			{TEXT("ships_spawned"), static_cast<double>(NumShipsSpawned)},
+			{TEXT("spawn_queries"), static_cast<double>(NumSpawnQueries)},
+			{TEXT("spawn_query_fallbacks"), static_cast<double>(NumSpawnQueryFallbacks)},
+			{TEXT("spawn_query_allocations"), static_cast<double>(NumSpawnQueryAllocations)},
+		};
+		Test.TestTrue(TEXT("Report written"), Recorder.WriteReport(ReportPath, World.IsValid() ? World->GetMapName() : FString(), ExtraFields));
+	}
+
+	void OnWorldTickStart(UWorld* InWorld, ELevelTick TickType, float DeltaTime)
+	{
+		if (InWorld != World.Get() || !Recorder.IsStarted())
+		{
+			return;
+		}
+
+		FrameStartCycles = FPlatformTime::Cycles64();
+		FrameDeltaSeconds = DeltaTime;
+	}
+
+	void OnEndFrame()
+	{
+		if (FrameStartCycles == 0)
+		{
+			return;
+		}
+
+		const double FrameMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - FrameStartCycles);
+		FrameStartCycles = 0;
+		Recorder.AddFrame(FrameDeltaSeconds, FrameMs, FPlatformTime::ToMilliseconds(GGameThreadTime), World->GetNetDriver());
+
+		if (GameMode.IsValid())
+		{
+			QuerySpawnLocation();
+		}
+	}
+
+	void OnPlayerDie(const APlayerController* Player, const AActor* PlayerActor, const APlayerController* Killer)
+	{
+		NumShipsDestroyed++;
+	}
+
+	void OnActorSpawned(AActor* Actor)
+	{
+		if (Actor->IsA<AAccelByteWarsPlayerPawn>())
+		{
+			NumShipsSpawned++;
+		}
+	}
+
+	FAutomationTestBase& Test;
+
+	const int32 NumBots;
+	const int32 RandomSeed;
+	const int32 TickRate;
+	const float MatchSeconds;
+	const FString ReportPath;
+
+	FRandomStream Random;
+	FAccelByteWarsMatchPerfRecorder Recorder;
+
+	/**
+	 * @brief Platform time the map was asked to open
+	 */
+	const double MapLoadStartTime;
+
+	TWeakObjectPtr<UWorld> World;
+	TWeakObjectPtr<AAccelByteWarsInGameGameMode> GameMode;
+	TArray<FPlayer> Players;
+
+	bool bSetUp = false;
+	bool bMatchStarted = false;
+	bool bMatchEnded = false;
+	float MatchStartTime = 0.0f;
+	float TimeLimit = 0.0f;
+
+	int32 NumMissilesFired = 0;
+	int32 NumShipsDestroyed = 0;
+	int32 NumShipsSpawned = 0;
+	int32 NumSpawnQueries = 0;
+	int32 NumSpawnQueryFallbacks = 0;
+	int64 NumSpawnQueryAllocations = 0;
+
+	/**
+	 * @brief Cycles when the match world started ticking, 0 if the current frame is not recorded
+	 */
+	uint64 FrameStartCycles = 0;
+	float FrameDeltaSeconds = 0.0f;
+
+	bool bSavedUseFixedTimeStep = false;
+	double SavedFixedDeltaTime = 0.0;
+
+	FDelegateHandle WorldTickStartHandle;
+	FDelegateHandle EndFrameHandle;
+	FDelegateHandle PlayerDieHandle;
+	FDelegateHandle ActorSpawnedHandle;
+};
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FAccelByteWarsHeadlessMatchCommand, TSharedRef<FAccelByteWarsHeadlessMatch>, Match);
+
+bool FAccelByteWarsHeadlessMatchCommand::Update()
+{
+	return Match->Update();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteWarsHeadlessMatchTest, "AccelByteWars.Perf.HeadlessMatch",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+/**
+ * Plays a full match on the in-game map with scripted local players and writes the match perf report, the same JSON as
+ * UAccelByteWarsMatchPerfSubsystem. After every recorded frame a spawn location query runs outside of the timing, it must
+ * not allocate, whether it finds a free location or falls back. Same seed, players and game mode give the same match, e.g.
+ * UnrealEditor-Cmd AccelByteWars.uproject -game -nullrhi -unattended -ExecCmds="Automation RunTests AccelByteWars.Perf.HeadlessMatch"
+ *   -TestExit="Automation Test Queue Empty" -MatchPerfBots=4 -MatchRandomSeed=42 -GameMode=<CodeName>
+ *   -HeadlessMatchReport=Saved/Perf/HeadlessMatch.json
+ * The players are local players, so the game mode's MaxPlayers and the splitscreen limit cap -MatchPerfBots.
+ * -MatchPerfSeconds=<s> ends the match early, -MatchPerfTickRate=<hz> sets the fixed time step (30).
+ * -MatchPerfReport is left to UAccelByteWarsMatchPerfSubsystem, it would overwrite this report when the world ends.
+ */
+bool FAccelByteWarsHeadlessMatchTest::RunTest(const FString& Parameters)
+{
+	int32 NumBots = 4;
+	FParse::Value(FCommandLine::Get(), TEXT("-MatchPerfBots="), NumBots);
+	int32 RandomSeed = 42;
+	FParse::Value(FCommandLine::Get(), TEXT("-MatchRandomSeed="), RandomSeed);
+	int32 TickRate = 30;
+	FParse::Value(FCommandLine::Get(), TEXT("-MatchPerfTickRate="), TickRate);
+	float MatchSeconds = 0.0f;
+	FParse::Value(FCommandLine::Get(), TEXT("-MatchPerfSeconds="), MatchSeconds);
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("Perf/HeadlessMatch.json");
+	FParse::Value(FCommandLine::Get(), TEXT("-HeadlessMatchReport="), ReportPath);
+
+	// the game mode seeds its own random numbers from -MatchRandomSeed when it begins play
+	const TSharedRef<FAccelByteWarsHeadlessMatch> Match = MakeShared<FAccelByteWarsHeadlessMatch>(
+		*this, FMath::Max(NumBots, 1), RandomSeed, FMath::Max(TickRate, 1), MatchSeconds, ReportPath);
+
+	if (!AutomationOpenMap(TEXT("/Game/ByteWars/Maps/GalaxyWorld/GalaxyWorld")))
+	{
+		AddError(TEXT("Failed to open the in-game map"));
+		return false;
+	}
+	ADD_LATENT_AUTOMATION_COMMAND(FAccelByteWarsHeadlessMatchCommand(Match));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
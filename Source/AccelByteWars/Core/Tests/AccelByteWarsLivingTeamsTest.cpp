@@ -0,0 +1,107 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/GameModes/AccelByteWarsLivingTeams.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteWarsLivingTeamsTest, "AccelByteWars.GameMode.LivingTeams",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Plays seeded matches of 64 synthetic players to the last team standing, free for all and 4 teams of 16.
+ * Players randomly die or leave, the living team count must match a fresh count after each of them.
+ */
+bool FAccelByteWarsLivingTeamsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumMatches = 100;
+	constexpr int32 NumPlayers = 64;
+	constexpr int32 NumStartingLives = 3;
+
+	struct FSyntheticPlayer
+	{
+		int32 TeamId = INDEX_NONE;
+		int32 NumLivesLeft = 0;
+		bool bConnected = true;
+	};
+
+	FRandomStream Random(NumMatches);
+	int32 NumMismatches = 0;
+
+	for (const int32 NumTeams : {NumPlayers, 4})
+	{
+		for (int32 Match = 0; Match < NumMatches; ++Match)
+		{
+			TArray<FSyntheticPlayer> Players;
+			TArray<int32> LivingPlayerIndices;
+			FAccelByteWarsLivingTeams LivingTeams;
+			for (int32 i = 0; i < NumPlayers; ++i)
+			{
+				Players.Add(FSyntheticPlayer{i % NumTeams, NumStartingLives});
+				LivingPlayerIndices.Add(i);
+
+				// the key only identifies the player
+				LivingTeams.SetPlayer(reinterpret_cast<const void*>(static_cast<UPTRINT>(i + 1)), i % NumTeams, NumStartingLives);
+			}
+			TestEqual(TEXT("Living teams at match start"), LivingTeams.Num(), NumTeams);
+
+			while (LivingTeams.Num() > 1)
+			{
+				const int32 LivingIndex = Random.RandHelper(LivingPlayerIndices.Num());
+				const int32 PlayerIndex = LivingPlayerIndices[LivingIndex];
+				const void* Key = reinterpret_cast<const void*>(static_cast<UPTRINT>(PlayerIndex + 1));
+				FSyntheticPlayer& Player = Players[PlayerIndex];
+
+				if (Random.RandHelper(20) == 0)
+				{
+					// leave, like Logout
+					Player.bConnected = false;
+					LivingTeams.RemovePlayer(Key);
+				}
+				else
+				{
+					// death, like DecreasePlayerLife
+					Player.NumLivesLeft--;
+					LivingTeams.SetPlayer(Key, Player.TeamId, Player.NumLivesLeft);
+				}
+
+				if (!Player.bConnected || Player.NumLivesLeft <= 0)
+				{
+					LivingPlayerIndices.RemoveAtSwap(LivingIndex);
+				}
+
+				TArray<int32> ActiveTeams;
+				for (const FSyntheticPlayer& CheckedPlayer : Players)
+				{
+					if (CheckedPlayer.bConnected && CheckedPlayer.NumLivesLeft > 0)
+					{
+						ActiveTeams.AddUnique(CheckedPlayer.TeamId);
+					}
+				}
+
+				if (LivingTeams.Num() != ActiveTeams.Num())
+				{
+					// one error per mismatch would flood the report, the first one is enough to start from
+					if (NumMismatches++ == 0)
+					{
+						AddError(FString::Printf(TEXT("Living team count %d differs from a fresh count %d in match %d of %d teams"),
+							LivingTeams.Num(), ActiveTeams.Num(), Match, NumTeams));
+					}
+				}
+			}
+
+			LivingTeams.Reset();
+			TestEqual(TEXT("Living teams after reset"), LivingTeams.Num(), 0);
+		}
+	}
+
+	TestEqual(TEXT("Deaths and leaves where the living team count differs from a fresh count"), NumMismatches, 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
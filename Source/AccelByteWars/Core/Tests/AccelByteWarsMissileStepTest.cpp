@@ -0,0 +1,192 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/SceneComponent.h"
+#include "Core/Actor/AccelByteWarsMissile.h"
+#include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Core/System/AccelByteWarsActorPoolSubsystem.h"
+#include "Core/System/AccelByteWarsMissileSubsystem.h"
+#include "Core/Tests/AccelByteWarsTestWorld.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteWarsFixedStepClockTest, "AccelByteWars.Missile.FixedStepClock",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Ten seconds of frames at 30, 60 and 120 Hz and with jittered frame times must run the same number of steps,
+ * and a hitch must be capped instead of caught up over the next frames.
+ */
+bool FAccelByteWarsFixedStepClockTest::RunTest(const FString& Parameters)
+{
+	constexpr double StepSeconds = 1.0 / 120.0;
+	constexpr double TotalSeconds = 10.0;
+	constexpr int32 MaxSteps = 16;
+
+	const int32 ExpectedSteps = FMath::FloorToInt(TotalSeconds / StepSeconds);
+
+	for (const int32 TickRate : {30, 60, 120})
+	{
+		FAccelByteWarsFixedStepClock Clock;
+		int32 NumSteps = 0;
+		for (int32 Frame = 0; Frame < TotalSeconds * TickRate; ++Frame)
+		{
+			// frame times reach the subsystem as float
+			NumSteps += Clock.Advance(static_cast<float>(1.0 / TickRate), StepSeconds, MaxSteps);
+		}
+
+		TestTrue(FString::Printf(TEXT("%d steps at %d Hz, %d expected"), NumSteps, TickRate, ExpectedSteps),
+			FMath::Abs(NumSteps - ExpectedSteps) <= 1);
+	}
+
+	// a loaded server, 10 to 50 ms frames
+	FRandomStream Random(MaxSteps);
+	FAccelByteWarsFixedStepClock Clock;
+	double ElapsedSeconds = 0.0;
+	int32 NumSteps = 0;
+	while (ElapsedSeconds < TotalSeconds)
+	{
+		const float DeltaSeconds = Random.FRandRange(0.01f, 0.05f);
+		ElapsedSeconds += DeltaSeconds;
+		NumSteps += Clock.Advance(DeltaSeconds, StepSeconds, MaxSteps);
+	}
+	TestTrue(FString::Printf(TEXT("%d steps with jittered frames, %.0f expected"), NumSteps, ElapsedSeconds / StepSeconds),
+		FMath::Abs(NumSteps - FMath::FloorToInt(ElapsedSeconds / StepSeconds)) <= 1);
+
+	// a one second hitch
+	Clock.Reset();
+	TestEqual(TEXT("Steps after a hitch"), Clock.Advance(1.0, StepSeconds, MaxSteps), MaxSteps);
+	TestEqual(TEXT("Time left over after a hitch"), Clock.Accumulator, 0.0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteWarsMissileVolleyTest, "AccelByteWars.Missile.VolleyTickRate",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Fires the same volley at a planet in a headless world ticked at 30, 60 and 120 Hz.
+ * Every missile must end the same way at every tick rate, and the missiles that hit the planet must hit it at the same point.
+ */
+bool FAccelByteWarsMissileVolleyTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumMissiles = 24;
+	constexpr float MaxFlightSeconds = 10.0f;
+	const FVector PlanetLocation = FVector::ZeroVector;
+
+	struct FMissileEnd
+	{
+		bool bEnded = false;
+		bool bHit = false;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	const TArray<int32> TickRates = {30, 60, 120};
+	TMap<int32, TArray<FMissileEnd>> EndsPerTickRate;
+
+	FAccelByteWarsTestWorld::AddExpectedGameStateErrors(*this, TickRates.Num());
+
+	for (const int32 TickRate : TickRates)
+	{
+		const FAccelByteWarsTestWorld World;
+		AAccelByteWarsInGameGameState* GameState = World.SpawnGameState();
+
+		// no game mode, the missiles have nobody to credit and are destroyed when they end
+		World->GetSubsystem<UAccelByteWarsActorPoolSubsystem>()->bEnabled = false;
+
+		AActor* Planet = World->SpawnActor<AActor>();
+		USceneComponent* PlanetRoot = NewObject<USceneComponent>(Planet);
+		Planet->SetRootComponent(PlanetRoot);
+		PlanetRoot->RegisterComponent();
+		Planet->SetActorLocation(PlanetLocation);
+
+		UAccelByteWarsGameplayObjectComponent* PlanetBody = NewObject<UAccelByteWarsGameplayObjectComponent>(Planet);
+		PlanetBody->ObjectType = EGameplayObjectType::PLANET;
+		PlanetBody->Mass = 50000.0f;
+		PlanetBody->Radius = 1.5f;
+		PlanetBody->RegisterComponent();
+		GameState->AddActiveGameObject(PlanetBody);
+
+		TArray<FMissileEnd>& Ends = EndsPerTickRate.Add(TickRate);
+		Ends.SetNum(NumMissiles);
+		TMap<const AActor*, int32> MissileIndices;
+
+		const FDelegateHandle DestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateLambda(
+			[&Ends, &MissileIndices](AActor* Actor)
+			{
+				const int32* Index = MissileIndices.Find(Actor);
+				if (Index == nullptr)
+				{
+					return;
+				}
+
+				const AAccelByteWarsMissile* Missile = CastChecked<AAccelByteWarsMissile>(Actor);
+				Ends[*Index].bEnded = true;
+				Ends[*Index].bHit = Missile->HitObject != nullptr;
+				Ends[*Index].Location = Missile->GetActorLocation();
+			}));
+
+		// a ring around the planet, roughly aimed at it so that some hit and some swing by
+		FRandomStream Random(NumMissiles);
+		for (int32 i = 0; i < NumMissiles; ++i)
+		{
+			const FRotator Bearing(0.0f, 360.0f * i / NumMissiles, 0.0f);
+			const FVector StartLocation = PlanetLocation + Bearing.Vector() * 800.0f;
+			const FRotator Aim(0.0f, Bearing.Yaw + 180.0f + Random.FRandRange(-40.0f, 40.0f), 0.0f);
+
+			AAccelByteWarsMissile* Missile = World->SpawnActorDeferred<AAccelByteWarsMissile>(
+				AAccelByteWarsMissile::StaticClass(), FTransform(Aim, StartLocation), nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+			Missile->AccelByteWarsGameplayObjectComponent->Mass = 1.0f;
+			Missile->AccelByteWarsGameplayObjectComponent->Radius = 0.2f;
+			Missile->MaxTimeAlive = MaxFlightSeconds;
+			Missile->Velocity = Aim.Vector() * Random.FRandRange(300.0f, 700.0f);
+			MissileIndices.Add(Missile, i);
+			Missile->FinishSpawning(FTransform(Aim, StartLocation));
+		}
+
+		const float DeltaSeconds = 1.0f / TickRate;
+		for (int32 Frame = 0; Frame < (MaxFlightSeconds + 1.0f) * TickRate; ++Frame)
+		{
+			World->Tick(LEVELTICK_All, DeltaSeconds);
+		}
+
+		World->RemoveOnActorDestroyedHandler(DestroyedHandle);
+	}
+
+	const TArray<FMissileEnd>& ReferenceEnds = EndsPerTickRate.FindChecked(120);
+	int32 NumHits = 0;
+	for (int32 i = 0; i < NumMissiles; ++i)
+	{
+		TestTrue(FString::Printf(TEXT("Missile %d ended within its lifetime"), i), ReferenceEnds[i].bEnded);
+		NumHits += ReferenceEnds[i].bHit ? 1 : 0;
+	}
+	TestTrue(TEXT("Some missiles of the volley hit the planet"), NumHits > 0);
+
+	for (const int32 TickRate : {30, 60})
+	{
+		const TArray<FMissileEnd>& Ends = EndsPerTickRate.FindChecked(TickRate);
+		for (int32 i = 0; i < NumMissiles; ++i)
+		{
+			if (!TestEqual(FString::Printf(TEXT("Missile %d hit at %d Hz like at 120 Hz"), i, TickRate), Ends[i].bHit, ReferenceEnds[i].bHit))
+			{
+				continue;
+			}
+
+			// out of bounds and timeouts are checked once per frame, only impacts happen on a substep
+			if (Ends[i].bHit)
+			{
+				TestTrue(FString::Printf(TEXT("Missile %d impact point at %d Hz matches 120 Hz"), i, TickRate),
+					Ends[i].Location.Equals(ReferenceEnds[i].Location, 0.01f));
+			}
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
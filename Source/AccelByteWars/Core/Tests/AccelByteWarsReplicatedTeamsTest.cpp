@@ -0,0 +1,130 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/GameStates/AccelByteWarsReplicatedTeams.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteWarsReplicatedTeamsTest, "AccelByteWars.GameState.ReplicatedTeams",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Syncs 2 teams of 3 local players, then a score change of one player and the first player of the first team leaving.
+ * An unknown player can't be synced on its own.
+ * Only the slots of the players involved may be dirtied, every other slot must keep its replication id and key,
+ * and the slots must rebuild the teams they were synced from.
+ */
+bool FAccelByteWarsReplicatedTeamsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumTeams = 2;
+	constexpr int32 NumMembers = 3;
+
+	TArray<FGameplayTeamData> Teams;
+	for (int32 TeamId = 0; TeamId < NumTeams; ++TeamId)
+	{
+		FGameplayTeamData& Team = Teams.Add_GetRef(FGameplayTeamData{TeamId});
+		for (int32 i = 0; i < NumMembers; ++i)
+		{
+			FGameplayPlayerData PlayerData;
+			PlayerData.ControllerId = TeamId * NumMembers + i;
+			PlayerData.TeamId = TeamId;
+			Team.TeamMembers.Add(PlayerData);
+		}
+	}
+
+	FAccelByteWarsReplicatedTeams ReplicatedTeams;
+	ReplicatedTeams.SyncFromTeams(Teams);
+	TestEqual(TEXT("Slots after the first sync"), ReplicatedTeams.Slots.Num(), NumTeams * (NumMembers + 1));
+
+	const auto GetReplicationState = [&ReplicatedTeams]()
+	{
+		TMap<FAccelByteWarsReplicatedTeamSlotKey, FIntPoint> ReplicationState;
+		for (const FAccelByteWarsReplicatedTeamSlot& Slot : ReplicatedTeams.Slots)
+		{
+			ReplicationState.Add(FAccelByteWarsReplicatedTeamSlotKey(Slot), FIntPoint(Slot.ReplicationID, Slot.ReplicationKey));
+		}
+		return ReplicationState;
+	};
+
+	const auto TestRoundTrip = [this, &ReplicatedTeams, &Teams](const TCHAR* What)
+	{
+		TArray<FGameplayTeamData> BuiltTeams;
+		ReplicatedTeams.BuildTeams(BuiltTeams);
+		if (!TestEqual(FString::Printf(TEXT("Teams rebuilt %s"), What), BuiltTeams.Num(), Teams.Num()))
+		{
+			return;
+		}
+
+		for (int32 TeamIndex = 0; TeamIndex < Teams.Num(); ++TeamIndex)
+		{
+			const TArray<FGameplayPlayerData>& Members = Teams[TeamIndex].TeamMembers;
+			const TArray<FGameplayPlayerData>& BuiltMembers = BuiltTeams[TeamIndex].TeamMembers;
+			TestEqual(FString::Printf(TEXT("Team %d id rebuilt %s"), TeamIndex, What), BuiltTeams[TeamIndex].TeamId, Teams[TeamIndex].TeamId);
+			if (!TestEqual(FString::Printf(TEXT("Team %d members rebuilt %s"), TeamIndex, What), BuiltMembers.Num(), Members.Num()))
+			{
+				continue;
+			}
+
+			for (int32 MemberIndex = 0; MemberIndex < Members.Num(); ++MemberIndex)
+			{
+				TestEqual(FString::Printf(TEXT("Team %d member %d rebuilt %s"), TeamIndex, MemberIndex, What),
+					BuiltMembers[MemberIndex].ControllerId, Members[MemberIndex].ControllerId);
+				TestEqual(FString::Printf(TEXT("Team %d member %d score rebuilt %s"), TeamIndex, MemberIndex, What),
+					BuiltMembers[MemberIndex].Score, Members[MemberIndex].Score);
+			}
+		}
+	};
+
+	TestRoundTrip(TEXT("after the first sync"));
+
+	// a score change dirties that player only, and a full sync after it finds nothing left to send
+	TMap<FAccelByteWarsReplicatedTeamSlotKey, FIntPoint> PreviousState = GetReplicationState();
+	Teams[1].TeamMembers[2].Score = 100.0f;
+	TestTrue(TEXT("Score change synced on its own"), ReplicatedTeams.SyncMember(Teams[1].TeamMembers[2]));
+	ReplicatedTeams.SyncFromTeams(Teams);
+
+	for (const FAccelByteWarsReplicatedTeamSlot& Slot : ReplicatedTeams.Slots)
+	{
+		const FIntPoint& Previous = PreviousState.FindChecked(FAccelByteWarsReplicatedTeamSlotKey(Slot));
+		const bool bChanged = !Slot.IsTeam() && Slot.PlayerData.ControllerId == Teams[1].TeamMembers[2].ControllerId;
+		TestEqual(FString::Printf(TEXT("Replication id of team %d member %d after a score change"), Slot.TeamId, Slot.MemberIndex),
+			Slot.ReplicationID, Previous.X);
+		TestEqual(FString::Printf(TEXT("Team %d member %d dirtied by a score change"), Slot.TeamId, Slot.MemberIndex),
+			Slot.ReplicationKey != Previous.Y, bChanged);
+	}
+	TestRoundTrip(TEXT("after a score change"));
+
+	// a player leaving removes their slot, only their teammates after them move
+	PreviousState = GetReplicationState();
+	Teams[0].TeamMembers.RemoveAt(0);
+	ReplicatedTeams.SyncFromTeams(Teams);
+	TestEqual(TEXT("Slots after a player left"), ReplicatedTeams.Slots.Num(), NumTeams * (NumMembers + 1) - 1);
+
+	for (const FAccelByteWarsReplicatedTeamSlot& Slot : ReplicatedTeams.Slots)
+	{
+		const FIntPoint& Previous = PreviousState.FindChecked(FAccelByteWarsReplicatedTeamSlotKey(Slot));
+		const bool bChanged = !Slot.IsTeam() && Slot.TeamId == Teams[0].TeamId;
+		TestEqual(FString::Printf(TEXT("Replication id of team %d member %d after a player left"), Slot.TeamId, Slot.MemberIndex),
+			Slot.ReplicationID, Previous.X);
+		TestEqual(FString::Printf(TEXT("Team %d member %d dirtied by a player leaving"), Slot.TeamId, Slot.MemberIndex),
+			Slot.ReplicationKey != Previous.Y, bChanged);
+	}
+	TestRoundTrip(TEXT("after a player left"));
+
+	// the player that left, then one that never joined
+	FGameplayPlayerData UnknownPlayer;
+	UnknownPlayer.TeamId = 0;
+	for (const int32 ControllerId : {0, NumTeams * NumMembers})
+	{
+		UnknownPlayer.ControllerId = ControllerId;
+		TestFalse(FString::Printf(TEXT("Player %d without a slot synced on its own"), ControllerId), ReplicatedTeams.SyncMember(UnknownPlayer));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,112 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/GameStates/AccelByteWarsTeamTotals.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAccelByteWarsTeamTotalsTest, "AccelByteWars.GameState.TeamTotals",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Applies seeded random joins, leaves, score, kill and lives changes to 4 teams,
+ * the cached totals must match a fresh sum of every team after each of them.
+ * Halfway through the second team is removed like RemovePlayerFromTeam does, so TeamIds stop matching indices in Teams.
+ */
+bool FAccelByteWarsTeamTotalsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumTeams = 4;
+	constexpr int32 NumMutations = 10000;
+	constexpr int32 RemovedTeamId = 1;
+
+	FRandomStream Random(NumMutations);
+	FAccelByteWarsTeamTotalsCache TeamTotals;
+
+	TArray<FGameplayTeamData> Teams;
+	for (int32 TeamId = 0; TeamId < NumTeams; ++TeamId)
+	{
+		Teams.Add(FGameplayTeamData{TeamId});
+	}
+
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumMutations; ++i)
+	{
+		if (i == NumMutations / 2)
+		{
+			Teams.RemoveAt(RemovedTeamId);
+			TeamTotals.MarkDirty();
+		}
+
+		FGameplayTeamData& Team = Teams[Random.RandRange(0, Teams.Num() - 1)];
+		const int32 Mutation = Random.RandRange(0, 9);
+
+		if (Mutation == 0 || Team.TeamMembers.IsEmpty())
+		{
+			// join, with a random state as if restored from a previous session
+			FGameplayPlayerData PlayerData;
+			PlayerData.ControllerId = 1000 + i;
+			PlayerData.TeamId = Team.TeamId;
+			PlayerData.Score = Random.RandRange(0, 500);
+			PlayerData.KillCount = Random.RandRange(0, 5);
+			PlayerData.NumLivesLeft = Random.RandRange(0, 3);
+			Team.TeamMembers.Add(PlayerData);
+			TeamTotals.MarkDirty();
+		}
+		else if (Mutation == 1)
+		{
+			// leave
+			Team.TeamMembers.RemoveAt(Random.RandRange(0, Team.TeamMembers.Num() - 1));
+			TeamTotals.MarkDirty();
+		}
+		else
+		{
+			FGameplayPlayerData& PlayerData = Team.TeamMembers[Random.RandRange(0, Team.TeamMembers.Num() - 1)];
+			switch (Mutation % 3)
+			{
+			case 0:
+				TeamTotals.SetPlayerScore(PlayerData, PlayerData.Score + Random.RandRange(-100, 300));
+				break;
+			case 1:
+				TeamTotals.SetPlayerKillCount(PlayerData, PlayerData.KillCount + 1);
+				break;
+			default:
+				TeamTotals.SetPlayerLivesLeft(PlayerData, PlayerData.NumLivesLeft - 1);
+				break;
+			}
+		}
+
+		for (const FGameplayTeamData& CheckedTeam : Teams)
+		{
+			const FAccelByteWarsTeamTotals* Totals = TeamTotals.Find(Teams, CheckedTeam.TeamId);
+			if (!Totals
+				|| !FMath::IsNearlyEqual(Totals->Score, CheckedTeam.GetTeamScore())
+				|| Totals->KillCount != CheckedTeam.GetTeamKillCount()
+				|| Totals->LivesLeft != CheckedTeam.GetTeamLivesLeft())
+			{
+				// one error per mismatch would flood the report, the first one is enough to start from
+				if (NumMismatches++ == 0)
+				{
+					AddError(FString::Printf(TEXT("Team %d totals differ from a fresh sum after mutation %d"), CheckedTeam.TeamId, i));
+				}
+			}
+		}
+	}
+
+	TestEqual(TEXT("Team checks where cached totals differ from a fresh sum"), NumMismatches, 0);
+	TestNull(TEXT("Totals of a team that does not exist"), TeamTotals.Find(Teams, NumTeams));
+	TestNull(TEXT("Totals of a removed team"), TeamTotals.Find(Teams, RemovedTeamId));
+
+	const FAccelByteWarsTeamTotals* LastTeamTotals = TeamTotals.Find(Teams, NumTeams - 1);
+	if (TestNotNull(TEXT("Totals of the last team after a team was removed"), LastTeamTotals))
+	{
+		TestEqual(TEXT("Lives of the last team, found by TeamId instead of index"), LastTeamTotals->LivesLeft, Teams.Last().GetTeamLivesLeft());
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
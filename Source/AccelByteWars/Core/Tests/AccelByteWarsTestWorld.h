@@ -0,0 +1,68 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+
+/**
+ * A bare game world for automation tests, registered with the engine like a loaded map and destroyed with this object.
+ * No map, game mode or game instance, tests spawn what they need in it.
+ */
+class FAccelByteWarsTestWorld
+{
+public:
+	FAccelByteWarsTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+	}
+
+	~FAccelByteWarsTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FAccelByteWarsTestWorld(const FAccelByteWarsTestWorld&) = delete;
+	FAccelByteWarsTestWorld& operator=(const FAccelByteWarsTestWorld&) = delete;
+
+	/**
+	 * @brief Spawn the in-game game state and begin play. Without a game mode nothing else begins play.
+	 * Every game state logs an error when there is no game instance to restore the teams from, see AddExpectedGameStateErrors.
+	 */
+	AAccelByteWarsInGameGameState* SpawnGameState() const
+	{
+		AAccelByteWarsInGameGameState* GameState = World->SpawnActor<AAccelByteWarsInGameGameState>();
+		World->SetGameState(GameState);
+		World->GetWorldSettings()->NotifyBeginPlay();
+		return GameState;
+	}
+
+	/**
+	 * @brief Expect the errors of the game states a test spawns with SpawnGameState, once per test
+	 */
+	static void AddExpectedGameStateErrors(FAutomationTestBase& Test, const int32 NumGameStates)
+	{
+		Test.AddExpectedError(TEXT("Game Instance is not"), EAutomationExpectedErrorFlags::Contains, NumGameStates);
+	}
+
+	UWorld* Get() const { return World; }
+	UWorld* operator->() const { return World; }
+
+private:
+	UWorld* World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
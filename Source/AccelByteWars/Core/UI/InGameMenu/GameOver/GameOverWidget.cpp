@@ -107,13 +107,14 @@ void UGameOverWidget::SetupLeaderboard()
 		if (Team.TeamMembers.IsEmpty()) continue;
 
 		// Get team with highest score.
-		if (Team.GetTeamScore() > HighestScore) 
+		const float TeamScore = GameState->GetTeamScore(Team.TeamId);
+		if (TeamScore > HighestScore) 
 		{
-			HighestScore = Team.GetTeamScore();
+			HighestScore = TeamScore;
 			WinnerTeamId = Team.TeamId;
 		}
 		// No winner, draw.
-		else if (Team.GetTeamScore() == HighestScore)
+		else if (TeamScore == HighestScore)
 		{
 			WinnerTeamId = INDEX_NONE;
 			WinnerPlayerName = TEXT("");